@@ -12,6 +12,8 @@
 
 #include "Bar.hpp"
 
+#include "profiler.hpp" /// PROFILE_SCOPE
+
 // Overload of the less than (<) operator for the Bar class
 bool Bar::operator<(Bar const& rhs) {
    return value < rhs.getValue();
@@ -24,16 +26,31 @@ bool Bar::operator>(Bar const& rhs) {
 
 // Get the label of the bar
 string Bar::getLabel() const {
-   return label;
+   return string(StringPool::getInstance().resolve(label));
 }
 
 // Get additional information related to the bar
 string Bar::getOtherRelatedInfo() const {
-   return other_related_info;
+   return string(StringPool::getInstance().resolve(other_related_info));
 }
 
 // Get the category to which the bar belongs
 string Bar::getCategory() const {
+   return string(StringPool::getInstance().resolve(category));
+}
+
+// Get the id of the label of the bar
+uint32_t Bar::getLabelId() const {
+   return label;
+}
+
+// Get the id of additional information related to the bar
+uint32_t Bar::getOtherRelatedInfoId() const {
+   return other_related_info;
+}
+
+// Get the id of the category to which the bar belongs
+uint32_t Bar::getCategoryId() const {
    return category;
 }
 
@@ -44,17 +61,17 @@ double long Bar::getValue() const {
 
 // Set the label of the bar
 void Bar::setLabel(string label_) {
-   label = label_;
+   label = StringPool::getInstance().intern(label_);
 }
 
 // Set additional information related to the bar
 void Bar::setOtherRelatedInfo(string other_related_info_) {
-   other_related_info = other_related_info_;
+   other_related_info = StringPool::getInstance().intern(other_related_info_);
 }
 
 // Set the category to which the bar belongs
 void Bar::setCategory(string category_) {
-   category = category_;
+   category = StringPool::getInstance().intern(category_);
 }
 
 // Set the value associated with the bar
@@ -63,8 +80,10 @@ void Bar::setValue(double long value_) {
 }
 
 // Draw and render the bar graphically
-void Bar::draw(
-  short bar_size, double long _base_value, short const _color) const {
+void Bar::draw(FrameBuffer& frame, short bar_size, double long _base_value,
+  short const _color) const {
+   PROFILE_SCOPE(PHASE_BAR_DRAW);
+
    short size;
    if (_base_value == 0) {
       size = bar_size;
@@ -72,16 +91,25 @@ void Bar::draw(
       size = (value * bar_size) / _base_value;
    }
 
-   ostringstream oss;
-   oss << setStyle(repeat("\u2588", size), _color) << " "
-       << setStyle(label, _color) << " ";
-   if (!other_related_info.empty()) {
-      string buffer { "(" + other_related_info + ")" };
-      oss << setStyle(buffer, _color) << " ";
-   }
+   // Resolve the interned strings only now that they are shown
+   StringPool const& pool { StringPool::getInstance() };
+   string_view const info { pool.resolve(other_related_info) };
+
+   // The escape sequences and the blocks are sliced from tables built once
+   string_view const opening { styleOpening(_color) };
+   string_view const closing { styleClosing() };
 
-   oss << std::fixed << std::setprecision(2);
-   oss << "[" << std::fixed << value << "]";
+   frame << opening;
+   for (short left { size }; left > 0; left -= BLOCK_BAR_LENGTH) {
+      frame << blockBar(left);
+   }
+   frame << closing << " " << opening << pool.resolve(label) << closing
+         << " ";
+   if (!info.empty()) {
+      frame << opening << "(" << info << ")" << closing << " ";
+   }
 
-   cout << oss.str() << "\n";
+   frame << "[";
+   frame.appendFixed(value, 2);
+   frame << "]\n";
 }
@@ -16,22 +16,25 @@
 #include <string> /// string
 using std::string;
 
-#include "fstring.hpp" /// repeat, setStyle, green
-using fos::repeat;
-using fos::setStyle;
+#include "fstring.hpp" /// blockBar, styleOpening, styleClosing, green
+using fos::BLOCK_BAR_LENGTH;
+using fos::blockBar;
+using fos::styleClosing;
+using fos::styleOpening;
 
-#include <iostream> /// cout
-using std::cout;
+#include "framebuffer.hpp" /// FrameBuffer
 
-#include <sstream> /// ostringstream
-using std::ostringstream;
+#include <cstdint> /// uint32_t
 
-#include <iomanip>
+#include "stringpool.hpp" /// StringPool
 
 ///< Definition of system constants >//
 constexpr short DEFAULT_BAR_COLOR {
    fos::foreground::green
 }; ///< Default bar color
+constexpr short NO_CATEGORY {
+   -1
+}; ///< Color of the StringPool ids that are not categories
 
 /**
  * @brief The Bar class represents an individual bar in a bar chart
@@ -57,6 +60,21 @@ class Bar {
     * @param value_ The value associated with the bar
     */
    Bar(string label_, string other_related_info_, string category_,
+     double long value_)
+       : label(StringPool::getInstance().intern(label_))
+       , other_related_info(
+           StringPool::getInstance().intern(other_related_info_))
+       , category(StringPool::getInstance().intern(category_))
+       , value(value_) { }
+
+   /**
+    * @brief Parameterized constructor for the Bar class from interned strings
+    * @param label_ The StringPool id of the label of the bar
+    * @param other_related_info_ The StringPool id of the additional information
+    * @param category_ The StringPool id of the category of the bar
+    * @param value_ The value associated with the bar
+    */
+   Bar(uint32_t label_, uint32_t other_related_info_, uint32_t category_,
      double long value_)
        : label(label_)
        , other_related_info(other_related_info_)
@@ -103,6 +121,24 @@ class Bar {
     */
    string getCategory() const;
 
+   /**
+    * @brief Get the StringPool id of the label of the bar
+    * @return The id of the label
+    */
+   uint32_t getLabelId() const;
+
+   /**
+    * @brief Get the StringPool id of the additional information of the bar
+    * @return The id of the additional information
+    */
+   uint32_t getOtherRelatedInfoId() const;
+
+   /**
+    * @brief Get the StringPool id of the category of the bar
+    * @return The id of the category
+    */
+   uint32_t getCategoryId() const;
+
    /**
     * @brief Get the value associated with the bar
     * @return The value of the bar as a double
@@ -135,20 +171,23 @@ class Bar {
 
    /**
     * @brief Draw and render the bar graphically
+    * @param frame The frame that receives the bar
     * @param bar_size The size of the bar
     * @param _base_value The base value to determine the bar's height (default:
     * 0)
     * @param _color The color to use for rendering the bar (default:
     * DEFAULT_BAR_COLOR)
     */
-   void draw(short bar_size, double long _base_value = 0,
+   void draw(FrameBuffer& frame, short bar_size, double long _base_value = 0,
      short const _color = DEFAULT_BAR_COLOR) const;
 
    private:
-   string label; ///< The label of the bar
-   string other_related_info; ///< Additional information related to the bar
-   string category; ///< The category to which the bar belongs
-   double long value; ///< The value associated with the bar
+   uint32_t label { 0 }; ///< StringPool id of the label of the bar
+   uint32_t other_related_info {
+      0
+   }; ///< StringPool id of additional information related to the bar
+   uint32_t category { 0 }; ///< StringPool id of the category of the bar
+   double long value { 0 }; ///< The value associated with the bar
 };
 
 #endif /// BAR_HPP_
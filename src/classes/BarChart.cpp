@@ -12,19 +12,97 @@
 
 #include "BarChart.hpp"
 
-// Destructor for the BarChart class
-BarChart::~BarChart() {
-   bars.clear();
+#include "profiler.hpp" /// PROFILE_SCOPE
+
+#include <type_traits> /// decay_t
+
+// Reserve space for a number of bars in every column
+void BarColumns::reserve(size_t capacity) {
+   values.reserve(capacity);
+   labels.reserve(capacity);
+   infos.reserve(capacity);
+   categories.reserve(capacity);
+   previous_ranks.reserve(capacity);
+}
+
+// Append a range of bars of other columns to every column
+void BarColumns::append(BarColumns const& other, size_t first, size_t length) {
+   values.insert(values.end(),
+     other.values.begin() + first,
+     other.values.begin() + first + length);
+   labels.insert(labels.end(),
+     other.labels.begin() + first,
+     other.labels.begin() + first + length);
+   infos.insert(infos.end(),
+     other.infos.begin() + first,
+     other.infos.begin() + first + length);
+   categories.insert(categories.end(),
+     other.categories.begin() + first,
+     other.categories.begin() + first + length);
+   previous_ranks.insert(previous_ranks.end(),
+     other.previous_ranks.begin() + first,
+     other.previous_ranks.begin() + first + length);
 }
 
+// Destructor for the BarChart class
+BarChart::~BarChart() { }
+
 // Getter for the 'time_stamp' attribute
 string BarChart::getTimeStamp() const {
    return time_stamp;
 }
 
-// Getter for the 'bars' attribute
-vector<shared_ptr<Bar>> BarChart::getBars() const {
-   return bars;
+// Get the number of bars in the BarChart
+size_t BarChart::getNumberOfBars() const {
+   return length;
+}
+
+// Get the number of largest bars in order at the start
+size_t BarChart::getNumberOfOrderedBars() const {
+   return ordered;
+}
+
+// Get a bar of the BarChart
+Bar BarChart::getBar(size_t index) const {
+   return Bar { getLabels()[index],
+      getInfos()[index],
+      getCategories()[index],
+      getValues()[index] };
+}
+
+// Get the values of the bars
+long double const* BarChart::getValues() const {
+   return columns ? columns->values.data() + first : nullptr;
+}
+
+// Get the ids of the labels of the bars
+uint32_t const* BarChart::getLabels() const {
+   return columns ? columns->labels.data() + first : nullptr;
+}
+
+// Get the ids of the other related info of the bars
+uint32_t const* BarChart::getInfos() const {
+   return columns ? columns->infos.data() + first : nullptr;
+}
+
+// Get the ids of the categories of the bars
+uint32_t const* BarChart::getCategories() const {
+   return columns ? columns->categories.data() + first : nullptr;
+}
+
+// Get the positions of the bars in the previous bar chart
+uint32_t const* BarChart::getPreviousRanks() const {
+   return columns ? columns->previous_ranks.data() + first : nullptr;
+}
+
+// Get the columns viewed by the BarChart
+shared_ptr<BarColumns const> BarChart::getColumns() const {
+   return columns;
+}
+
+// Get the position of the first bar in the columns
+size_t BarChart::getFirst() const {
+   return first;
 }
 
 // Setter for the 'time_stamp' attribute
@@ -32,62 +110,194 @@ void BarChart::setTimeStamp(string time_stamp_) {
    time_stamp = time_stamp_;
 }
 
-// Add a Bar to the 'bars' vector
+// Add a Bar after the other bars
 void BarChart::addBar(Bar const* bar) {
-   shared_ptr<Bar> ptr { make_shared<Bar>(*bar) };
+   if (!bar) {
+      return;
+   }
+
+   detach(length + 1);
+
+   // The ordered bars are still the largest ones if the new bar is not larger
+   bool const keeps_order { ordered == 0
+     || bar->getValue() <= columns->values[ordered - 1] };
 
-   if (bars.empty() && bar) {
-      bars.push_back(ptr);
-   } else if (bar) {
-      shared_ptr<Bar>* local = upperBound<shared_ptr<Bar>>(ptr,
-        &(*bars.begin()),
-        &(*bars.end()),
-        [](shared_ptr<Bar> const& first, shared_ptr<Bar> const& second)
-          -> bool { return *(first.get()) > *(second.get()); });
+   columns->values.push_back(bar->getValue());
+   columns->labels.push_back(bar->getLabelId());
+   columns->infos.push_back(bar->getOtherRelatedInfoId());
+   columns->categories.push_back(bar->getCategoryId());
+   columns->previous_ranks.push_back(NO_RANK);
 
-      bars.insert(bars.begin() + distance(&bars.front(), local), ptr);
+   if (!keeps_order) {
+      ordered = 0;
+   } else if (ordered == length) {
+      ++ordered;
    }
+
+   ++length;
 }
 
-// Draw the BarChart with specified parameters
-void BarChart::draw(short bar_size, short _view_bars, short _ticks,
-  short _terminal_size, map<string, short> _colors) const {
-   string buffer { "Time stamp: " + time_stamp };
+// Put the largest bars in order at the start
+void BarChart::order(size_t count) {
+   count = std::min(count, length);
 
-   if (_terminal_size != 0) {
-      buffer = columnWrap(buffer, _terminal_size);
-      buffer = alignment(buffer, _terminal_size, center, " ");
+   if (count <= ordered) {
+      return;
+   }
+
+   PROFILE_SCOPE(PHASE_SORT);
+
+   detach();
+
+   long double const* values { columns->values.data() };
+   vector<size_t> indexes(length);
+   std::iota(indexes.begin(), indexes.end(), 0);
+
+   LargerBar const larger { values };
+
+   if (count == length) {
+      std::sort(indexes.begin(), indexes.end(), larger);
+   } else {
+      std::partial_sort(
+        indexes.begin(), indexes.begin() + count, indexes.end(), larger);
+      indexes.resize(count);
    }
 
-   cout << setStyle(buffer, blue, -1, bold) << "\n\n";
+   arrangeTop(indexes, columns->previous_ranks);
+}
+
+// Move the largest bars to the start, the other ones keeping their order
+void BarChart::arrangeTop(
+  vector<size_t> const& top, vector<uint32_t> const& previous_ranks) {
+   detach();
+
+   // The other bars are shifted back over the ones moved, from the end
+   vector<size_t> moved { top };
+   std::sort(moved.begin(), moved.end());
+
+   auto const rearrange { [&](auto& column, auto const& source) {
+      using Value = typename std::decay_t<decltype(column)>::value_type;
+      vector<Value> promoted;
+      promoted.reserve(top.size());
+
+      for (size_t index : top) {
+         promoted.push_back(source[index]);
+      }
+
+      size_t target { length };
+      size_t next_moved { moved.size() };
+
+      for (size_t index { length }; index-- != 0;) {
+         if (next_moved != 0 && moved[next_moved - 1] == index) {
+            --next_moved;
+            continue;
+         }
+
+         column[--target] = source[index];
+      }
+
+      std::copy(promoted.begin(), promoted.end(), column.begin());
+   } };
+
+   rearrange(columns->values, columns->values);
+   rearrange(columns->labels, columns->labels);
+   rearrange(columns->infos, columns->infos);
+   rearrange(columns->categories, columns->categories);
+
+   columns->previous_ranks.resize(length);
+   rearrange(columns->previous_ranks, previous_ranks);
+
+   ordered = top.size();
+}
+
+// Give the BarChart columns of its own if it shares them
+void BarChart::detach(size_t _capacity) {
+   if (columns && columns.use_count() == 1 && first == 0
+     && length == columns->values.size()) {
+      return;
+   }
 
-   long double max_bar_value { !bars.empty() ? bars.front().get()->getValue()
-                                             : 0 };
-   _view_bars = _view_bars == 0 ? bars.size() : _view_bars;
+   shared_ptr<BarColumns> own { make_shared<BarColumns>() };
+   own->reserve(std::max(_capacity, length));
+
+   if (columns) {
+      own->append(*columns, first, length);
+   }
+
+   columns = own;
+   first = 0;
+}
+
+// Draw the BarChart with specified parameters
+void BarChart::draw(FrameBuffer& frame, short bar_size, short _view_bars,
+  short _ticks, short _terminal_size, vector<short> const& _colors) const {
+   frame << getTimeStampLine(_terminal_size);
+   drawBars(frame, bar_size, _view_bars, _ticks, _terminal_size, _colors);
+}
+
+// Draw the bars and the axis of the BarChart
+void BarChart::drawBars(FrameBuffer& frame, short bar_size, short _view_bars,
+  short _ticks, short _terminal_size, vector<short> const& _colors) const {
+   // Bars shown or used by the axis, which need to be in order
+   size_t const view_bars { _view_bars == 0 ? length
+                                            : static_cast<size_t>(_view_bars) };
+   size_t const needed { std::min(
+     length, std::max(view_bars, static_cast<size_t>(_ticks))) };
+
+   if (needed > ordered) {
+      // Order a copy of the bars, as the columns may be shared
+      BarChart ordered_chart { *this };
+      ordered_chart.order(needed);
+      ordered_chart.drawBars(
+        frame, bar_size, _view_bars, _ticks, _terminal_size, _colors);
+      return;
+   }
+
+   long double const* values { getValues() };
+   uint32_t const* categories { getCategories() };
+   long double max_bar_value { length != 0 ? values[0] : 0 };
    short color { DEFAULT_BAR_COLOR };
 
-   for (short view_bar { 0 }; view_bar != _view_bars; ++view_bar) {
-      if (view_bar < bars.size()) {
-         Bar* bar { bars[view_bar].get() };
+   for (size_t view_bar { 0 }; view_bar != view_bars; ++view_bar) {
+      if (view_bar < length) {
+         uint32_t const category { categories[view_bar] };
 
-         if (_colors.find(bar->getCategory()) != _colors.end()) {
-            color = _colors[bar->getCategory()];
+         if (category < _colors.size() && _colors[category] != NO_CATEGORY) {
+            color = _colors[category];
          }
 
-         bar->draw(bar_size, max_bar_value, color);
+         getBar(view_bar).draw(frame, bar_size, max_bar_value, color);
       } else {
-         cout << "\n";
+         frame << "\n";
       }
 
-      cout << "\n";
+      frame << "\n";
    }
 
-   drawAxisX(bar_size, _view_bars, _ticks, _terminal_size);
+   drawAxisX(frame,
+     bar_size,
+     static_cast<short>(view_bars),
+     _ticks,
+     _terminal_size);
+}
+
+// Get the styled line of the time stamp
+string BarChart::getTimeStampLine(short _terminal_size) const {
+   string buffer { "Time stamp: " + time_stamp };
+
+   if (_terminal_size != 0) {
+      string wrapped;
+      appendColumnWrap(wrapped, buffer, _terminal_size);
+      buffer.clear();
+      appendAlignment(buffer, wrapped, _terminal_size, center);
+   }
+
+   return setStyle(buffer, blue, -1, bold) + "\n\n";
 }
 
 // Draw a horizontal bar below the chart with ticks representing intervals
-void BarChart::drawAxisX(
-  short bar_size, short _view_bars, short _ticks, short _terminal_size) const {
+void BarChart::drawAxisX(FrameBuffer& frame, short bar_size, short _view_bars,
+  short _ticks, short _terminal_size) const {
 
    string axis_x;
 
@@ -101,61 +311,79 @@ void BarChart::drawAxisX(
 
    string axis_x_numbers { repeat(' ', bar_size * 2 - 1) };
 
-   if (_ticks == 0 && _view_bars > bars.size()) {
-      _ticks = bars.size();
-   } else if (_ticks == 0) {
-      _ticks = _view_bars;
-   } else if (_ticks > bars.size()) {
-      _ticks = bars.size();
+   // The counts are compared with the number of bars
+   size_t const view_bars { static_cast<size_t>(_view_bars) };
+   size_t ticks { static_cast<size_t>(_ticks) };
+
+   if (ticks == 0 && view_bars > length) {
+      ticks = length;
+   } else if (ticks == 0) {
+      ticks = view_bars;
+   } else if (ticks > length) {
+      ticks = length;
    }
 
-   short last_bar;
+   size_t last_bar;
 
-   if (_ticks < _view_bars && _view_bars < bars.size()) {
-      last_bar = _view_bars - 1;
-   } else if (_ticks < _view_bars) {
-      last_bar = bars.size() - 1;
-   } else if (_ticks > _view_bars && _view_bars < bars.size()) {
-      last_bar = _view_bars - 1;
+   if (ticks < view_bars && view_bars < length) {
+      last_bar = view_bars - 1;
+   } else if (ticks < view_bars) {
+      last_bar = length - 1;
+   } else if (ticks > view_bars && view_bars < length) {
+      last_bar = view_bars - 1;
    } else {
-      last_bar = _ticks - 1;
+      last_bar = ticks - 1;
    }
 
    long double maximum_value { 0 };
    long double minimum_value { 0 };
 
-   if (!bars.empty()) {
-      maximum_value = ceil(bars.front()->getValue() / 100) * 100;
+   long double const* bar_values { getValues() };
+
+   // Values that are not numbers, ordered last, are left out of the axis
+   if (length != 0 && !std::isnan(bar_values[0])) {
+      maximum_value = ceil(bar_values[0] / 100) * 100;
    }
 
-   if (bars.size() > last_bar) {
-      minimum_value = floor(bars[last_bar]->getValue() / 100) * 100;
+   if (length > last_bar && !std::isnan(bar_values[last_bar])) {
+      minimum_value = floor(bar_values[last_bar] / 100) * 100;
    }
 
-   long double divided { floor((maximum_value - minimum_value) / _ticks) };
+   long double divided { floor((maximum_value - minimum_value) / ticks) };
 
-   double values[_ticks + 1];
+   double values[ticks + 1];
    values[0] = 0;
 
    long double value { minimum_value };
 
-   for (short index { 1 }; index < _ticks; ++index) {
+   for (size_t index { 1 }; index < ticks; ++index) {
       values[index] = value;
       value += divided;
    }
 
-   values[_ticks] = maximum_value;
+   values[ticks] = maximum_value;
 
-   for (short tick { 0 }; tick < _ticks + 1; ++tick) {
-      short position { static_cast<short>(
-        values[tick] * bar_size / values[_ticks]) };
+   for (size_t tick { 0 }; tick < ticks + 1; ++tick) {
+      // Without a maximum every tick is at the start of the axis
+      double const offset { values[ticks] != 0
+          ? values[tick] * bar_size / values[ticks]
+          : 0 };
+
+      if (!(offset >= 0 && offset < axis_x.size()
+            && offset < axis_x_numbers.size())) {
+         // Ticks out of the axis, from bars out of order, are not drawn
+         continue;
+      }
 
+      size_t const position { static_cast<size_t>(offset) };
       axis_x[position] = '+';
 
-      string value_str = to_string(static_cast<int>(values[tick]));
-      axis_x_numbers.replace(position, value_str.size(), value_str);
+      char value_str[NUMBER_CAPACITY];
+      size_t const value_size { formatInteger(
+        value_str, sizeof(value_str), static_cast<int>(values[tick])) };
+      axis_x_numbers.replace(position, value_size, value_str, value_size);
    }
 
-   cout << axis_x << "\n";
-   cout << setStyle(axis_x_numbers, yellow, -1, bold) << "\n";
+   frame << axis_x << "\n";
+   frame << setStyle(axis_x_numbers, yellow, -1, bold) << "\n";
 }
\ No newline at end of file
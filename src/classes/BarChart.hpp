@@ -16,12 +16,13 @@
 
 #include "Bar.hpp"
 
-#include "searching.hpp" /// upperBound
-using sch::upperBound;
+#include "fnumber.hpp" /// formatInteger, NUMBER_CAPACITY
+using fos::formatInteger;
+using fos::NUMBER_CAPACITY;
 
-#include "fstring.hpp" /// alignment, columnWrap, repeat, setStyle, center, blue, yellow, bold
-using fos::alignment;
-using fos::columnWrap;
+#include "fstring.hpp" /// appendAlignment, appendColumnWrap, repeat, setStyle, center, blue, yellow, bold
+using fos::appendAlignment;
+using fos::appendColumnWrap;
 using fos::repeat;
 using fos::setStyle;
 using fos::align::center;
@@ -44,19 +45,97 @@ using std::shared_ptr;
 using std::distance;
 using std::next;
 
-#include <map> /// map
-using std::map;
+#include <cstdint> /// uint32_t
 
-#include <iostream> /// cout
-using std::cout;
+#include <algorithm> /// copy, partial_sort, sort, min, max
+
+#include <numeric> /// iota
+
+#include "framebuffer.hpp" /// FrameBuffer
+
+#include <cmath> /// isnan
 
 #include <math.h> /// ceil, floor, round
 using std::ceil;
 using std::floor;
 using std::round;
 
+///< Definition of system constants >//
+constexpr uint32_t NO_RANK {
+   UINT32_MAX
+}; ///< Previous rank of a bar absent from the previous bar chart >//
+
+/**
+ * @brief Columns of the bars of one or more bar charts, stored contiguously
+ *
+ * The bars of a bar chart are a range of positions of these columns, sorted
+ * from the largest value to the smallest one.
+ */
+struct BarColumns {
+   vector<long double> values; ///< Value of each bar
+   vector<uint32_t> labels; ///< StringPool id of the label of each bar
+   vector<uint32_t> infos; ///< StringPool id of the other related info
+   vector<uint32_t> categories; ///< StringPool id of the category of each bar
+   vector<uint32_t>
+     previous_ranks; ///< Position of each bar in the previous bar chart
+
+   /**
+    * @brief Reserve space for a number of bars in every column
+    * @param capacity Number of bars
+    */
+   void reserve(size_t capacity);
+
+   /**
+    * @brief Append a range of bars of other columns to every column
+    * @param other Columns holding the bars
+    * @param first Position of the first bar in other
+    * @param length Number of bars
+    */
+   void append(BarColumns const& other, size_t first, size_t length);
+};
+
+/**
+ * @brief Order of the bars of columns, from the largest value to the smallest
+ *
+ * Values that are not numbers come after every number. Bars with equal
+ * values, or whose values are both not numbers, keep the order in which they
+ * were added, so the order is strict and weak even with such values.
+ */
+struct LargerBar {
+   long double const* values; ///< Value of each bar
+
+   /**
+    * @brief Check if a bar comes before another one
+    * @param lhs Position of the first bar
+    * @param rhs Position of the second bar
+    * @return true if the first bar comes first, false otherwise
+    */
+   bool operator()(size_t lhs, size_t rhs) const {
+      bool const lhs_number { !std::isnan(values[lhs]) };
+      bool const rhs_number { !std::isnan(values[rhs]) };
+
+      if (lhs_number != rhs_number) {
+         return lhs_number;
+      }
+
+      if (lhs_number && values[lhs] != values[rhs]) {
+         return values[lhs] > values[rhs];
+      }
+
+      return lhs < rhs;
+   }
+};
+
 /**
  * @brief The BarChart class represents a bar chart with associated data
+ *
+ * A BarChart is a view of a range of BarColumns, which may be shared with
+ * many other bar charts. Adding a bar to a BarChart that shares its columns
+ * first gives it columns of its own.
+ *
+ * Bars are appended as they come and only the largest ones are put in order
+ * by order(), as drawing never shows more than a few of them. Bars with equal
+ * values keep the order in which they were added.
  */
 class BarChart {
    public:
@@ -72,6 +151,23 @@ class BarChart {
     */
    BarChart(string time_stamp_) : time_stamp(time_stamp_) {};
 
+   /**
+    * @brief Constructor for a BarChart viewing a range of shared columns
+    *
+    * @param time_stamp_ The time stamp associated with the BarChart
+    * @param columns_ The columns holding the bars
+    * @param first_ Position of the first bar in the columns
+    * @param length_ Number of bars
+    * @param ordered_ Number of largest bars already in order at the start
+    */
+   BarChart(string time_stamp_, shared_ptr<BarColumns> columns_,
+     size_t first_, size_t length_, size_t ordered_)
+       : time_stamp(time_stamp_)
+       , columns(columns_)
+       , first(first_)
+       , length(length_)
+       , ordered(ordered_) {};
+
    /**
     * @brief Destructor for the BarChart class
     */
@@ -85,11 +181,80 @@ class BarChart {
    string getTimeStamp() const;
 
    /**
-    * @brief Get a vector of shared pointers to the Bar objects in the BarChart
+    * @brief Get the number of bars in the BarChart
+    *
+    * @return The number of bars
+    */
+   size_t getNumberOfBars() const;
+
+   /**
+    * @brief Get the number of bars at the start of the BarChart that are the
+    * largest ones, from the largest value
+    *
+    * @return The number of ordered bars
+    */
+   size_t getNumberOfOrderedBars() const;
+
+   /**
+    * @brief Get a bar of the BarChart
+    *
+    * @param index Position of the bar. Bars before getNumberOfOrderedBars()
+    * are the largest ones, from the largest value (0)
+    * @return The bar
+    */
+   Bar getBar(size_t index) const;
+
+   /**
+    * @brief Get the values of the bars
+    *
+    * @return Pointer to getNumberOfBars() contiguous values
+    */
+   long double const* getValues() const;
+
+   /**
+    * @brief Get the StringPool ids of the labels of the bars
+    *
+    * @return Pointer to getNumberOfBars() contiguous ids
+    */
+   uint32_t const* getLabels() const;
+
+   /**
+    * @brief Get the StringPool ids of the other related info of the bars
+    *
+    * @return Pointer to getNumberOfBars() contiguous ids
+    */
+   uint32_t const* getInfos() const;
+
+   /**
+    * @brief Get the StringPool ids of the categories of the bars
+    *
+    * @return Pointer to getNumberOfBars() contiguous ids
+    */
+   uint32_t const* getCategories() const;
+
+   /**
+    * @brief Get the positions of the bars in the previous bar chart
+    *
+    * Positions past the ordered bars of the previous bar chart are not
+    * ranks, and NO_RANK marks a bar absent from the previous bar chart.
+    *
+    * @return Pointer to getNumberOfBars() contiguous ranks
+    */
+   uint32_t const* getPreviousRanks() const;
+
+   /**
+    * @brief Get the columns viewed by the BarChart
+    *
+    * @return The columns, which may be shared and hold other bars
+    */
+   shared_ptr<BarColumns const> getColumns() const;
+
+   /**
+    * @brief Get the position of the first bar in the columns
     *
-    * @return A vector of shared pointers to Bar objects
+    * @return The position of the first bar
     */
-   vector<shared_ptr<Bar>> getBars() const;
+   size_t getFirst() const;
 
    /**
     * @brief Set the time stamp associated with the BarChart
@@ -99,25 +264,83 @@ class BarChart {
    void setTimeStamp(string time_stamp_);
 
    /**
-    * @brief Add a new Bar object to the BarChart
+    * @brief Add a new Bar object after the other bars of the BarChart
     *
     * @param bar A pointer to the Bar object to be added
     */
    void addBar(Bar const* bar);
 
+   /**
+    * @brief Put the largest bars in order at the start of the BarChart
+    *
+    * Only the selected bars are sorted, in O(n log count), and the other ones
+    * keep the order in which they were added.
+    *
+    * @param count Number of largest bars to put in order (all if larger than
+    * the number of bars)
+    */
+   void order(size_t count);
+
+   /**
+    * @brief Move the largest bars, in a known order, to the start of the
+    * BarChart, the other ones keeping the order in which they were added
+    *
+    * The columns are rearranged in place, in O(n) without any sort.
+    *
+    * @param top Current position of the bar to place at each of the first
+    * positions, which must be the largest bars sorted by value
+    * @param previous_ranks Position in the previous bar chart of each bar,
+    * by its current position
+    */
+   void arrangeTop(
+     vector<size_t> const& top, vector<uint32_t> const& previous_ranks);
+
    /**
     * @brief Draw the BarChart with specified parameters
     *
+    * @param frame The frame that receives the BarChart
     * @param bar_size The size of each bar
     * @param _view_bars The number of bars to display
-    * @param _colors A map of colors for different categories
+    * @param _colors The color of each category, indexed by StringPool id
     */
-   void draw(short bar_size, short _view_bars = 0, short _ticks = 0,
-     short _terminal_size = 0, map<string, short> _colors = {}) const;
+   void draw(FrameBuffer& frame, short bar_size, short _view_bars = 0,
+     short _ticks = 0,
+     short _terminal_size = 0, vector<short> const& _colors = {}) const;
+
+   /**
+    * @brief Draw the bars and the axis of the BarChart, without the line of
+    * its time stamp
+    *
+    * @param frame The frame that receives the bars
+    * @param bar_size The size of each bar
+    * @param _view_bars The number of bars to display
+    * @param _colors The color of each category, indexed by StringPool id
+    */
+   void drawBars(FrameBuffer& frame, short bar_size, short _view_bars = 0,
+     short _ticks = 0, short _terminal_size = 0,
+     vector<short> const& _colors = {}) const;
+
+   /**
+    * @brief Get the styled line of the time stamp, as drawn above the bars
+    *
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    * @return The line, followed by a blank line
+    */
+   string getTimeStampLine(short _terminal_size = 0) const;
 
    private:
    string time_stamp; ///< The time stamp associated with the BarChart
-   vector<shared_ptr<Bar>> bars; ///< A vector of shared pointers to Bar objects
+   shared_ptr<BarColumns> columns; ///< Columns holding the bars
+   size_t first { 0 }; ///< Position of the first bar in the columns
+   size_t length { 0 }; ///< Number of bars
+   size_t ordered { 0 }; ///< Number of largest bars in order at the start
+
+   /**
+    * @brief Give the BarChart columns of its own if it shares them
+    *
+    * @param _capacity Number of bars to reserve
+    */
+   void detach(size_t _capacity = 0);
 
    /**
     * @brief Draw a horizontal bar below the chart with ticks representing
@@ -128,6 +351,7 @@ class BarChart {
     * chart. It allows you to customize the size of the bar, the number of
     * displayed ticks, and the terminal size for proper formatting
     *
+    * @param frame The frame that receives the axis
     * @param bar_size Size of the horizontal bar
     * @param _view_bars Number of bars to display (0 to show all)
     * @param _ticks Number of ticks to display on the horizontal bar (0 for
@@ -137,8 +361,8 @@ class BarChart {
     *
     * @note Ensure that chart data is available before calling this function
     */
-   void drawAxisX(short bar_size, short _view_bars = 0, short _ticks = 0,
-     short _terminal_size = 0) const;
+   void drawAxisX(FrameBuffer& frame, short bar_size, short _view_bars = 0,
+     short _ticks = 0, short _terminal_size = 0) const;
 };
 
 #endif /// BAR_CHART_HPP_
\ No newline at end of file
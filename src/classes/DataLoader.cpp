@@ -0,0 +1,346 @@
+/**
+ * @file DataLoader.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the DataLoader class, which builds a Database from
+ * the lines of a data file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "DataLoader.hpp"
+
+#include "profiler.hpp" /// PROFILE_SCOPE
+
+#include <set> /// set
+
+#include <algorithm> /// max
+
+#include <cmath> /// isfinite
+
+// Read the header and every bar chart of the data into a Database
+void DataLoader::load(
+  LineReader& reader, Database& database, vector<string>& warnings) {
+   loadHeader(reader, database);
+   loadBlocks(reader, database, warnings);
+}
+
+// Read the title, scale and source of the data into a Database
+void DataLoader::loadHeader(LineReader& reader, Database& database) {
+   for (short header { 0 }; header != HEADER_SIZE; ++header) {
+      reader.next(line);
+
+      if (header == 0) {
+         // Set the title of the database from the first line
+         database.setTitle(string(line));
+      } else if (header == 1) {
+         // Set the scale of the database from the second line
+         database.setScale(string(line));
+      } else {
+         // Set the source of the database from the third line
+         database.setSource(string(line));
+      }
+   }
+}
+
+// Read every bar chart of the data into a Database
+bool DataLoader::loadBlocks(LineReader& reader, Database& database,
+  vector<string>& warnings, FrameQueue* _frames) {
+   if (_frames != nullptr || getNumberOfThreads() == 1) {
+      DataBlock block;
+      bool complete { true };
+
+      while (nextBlock(reader, block)) {
+         BlockResult result;
+         buildBlock(block, result);
+         shared_ptr<BarChart> bar_chart { addBlock(
+           result, database, warnings) };
+
+         if (_frames != nullptr && !_frames->push(bar_chart)) {
+            // Nobody is drawing anymore
+            complete = false;
+            break;
+         }
+
+         if (_frames != nullptr
+           && StringPool::getInstance().size() >= reclaim_at) {
+            // Bound the strings to the ones of the bar charts in memory
+            reclaim_at = std::max(
+              MINIMUM_RECLAIM, 2 * database.reclaimStrings());
+         }
+      }
+
+      if (_frames != nullptr) {
+         _frames->close();
+      }
+
+      return complete;
+   }
+
+   // Locate every block first, then build them on a pool of workers. A deque
+   // keeps the blocks in place, so the views into their storage stay valid
+   deque<DataBlock> blocks;
+
+   for (DataBlock block; nextBlock(reader, block);) {
+      blocks.push_back(std::move(block));
+      block = DataBlock();
+   }
+
+   vector<BlockResult> results(blocks.size());
+   atomic<size_t> next_block { 0 };
+   unsigned const threads { getNumberOfThreads() };
+   vector<thread> workers;
+
+   for (unsigned worker { 0 }; worker != threads; ++worker) {
+      workers.emplace_back([&]() {
+         for (size_t index { next_block++ }; index < blocks.size();
+              index = next_block++) {
+            buildBlock(blocks[index], results[index]);
+         }
+      });
+   }
+
+   for (thread& worker : workers) {
+      worker.join();
+   }
+
+   // Stitch the bar charts back in file order
+   for (BlockResult& result : results) {
+      addBlock(result, database, warnings);
+   }
+
+   return true;
+}
+
+// Get the maximum number of bars found in a bar chart
+short DataLoader::getMaxNumberOfBars() const {
+   return max_number_of_bars;
+}
+
+// Get the number of threads used to build the blocks
+unsigned DataLoader::getNumberOfThreads() const {
+   if (program_config.parse_threads > 0) {
+      return program_config.parse_threads;
+   }
+
+   unsigned const hardware { thread::hardware_concurrency() };
+   return hardware == 0 ? 1 : hardware;
+}
+
+// Read the rows of the next block
+bool DataLoader::nextBlock(LineReader& reader, DataBlock& block) {
+   PROFILE_SCOPE(PHASE_READ);
+
+   block.rows.clear();
+   block.storage.clear();
+   block.short_block = false;
+
+   if (!reader.next(line)) {
+      return false;
+   }
+
+   block.number = block_number++;
+
+   int quantify { 0 };
+   bool pending_line { false };
+
+   if (!isQuantify(line, quantify) && line_error) {
+      // The line was read by the previous block, which was shorter than
+      // specified, and is the first row of this one
+      quantify = quantify_buffer;
+      line_error = false;
+      pending_line = true;
+   }
+
+   for (int row { 0 }; row != quantify; ++row) {
+      if (!pending_line) {
+         // At the end of the input the last line is read again
+         reader.next(line);
+      } else {
+         pending_line = false;
+      }
+
+      if (isQuantify(line, quantify_buffer)) {
+         line_error = true;
+         block.short_block = true;
+         break;
+      }
+
+      if (reader.isStable()) {
+         block.rows.push_back(line);
+      } else {
+         block.storage.emplace_back(line);
+         block.rows.push_back(block.storage.back());
+      }
+   }
+
+   return true;
+}
+
+// Build the bar chart of a block
+void DataLoader::buildBlock(DataBlock const& block, BlockResult& result) const {
+   PROFILE_SCOPE(PHASE_PARSE_BLOCK);
+
+   // Each worker keeps the ids it interned, so repeated strings skip the pool
+   thread_local StringCache cache;
+   vector<string_view> columns;
+   std::set<uint32_t> categories_found;
+   int invalid_values { 0 };
+   int out_of_range_values { 0 };
+   int not_finite_values { 0 };
+
+   for (string_view row : block.rows) {
+      {
+         PROFILE_SCOPE(PHASE_SPLIT);
+         splitWithEmpty(row, columns, ",");
+      }
+
+      bool restart_for { false };
+
+      for (short index { 0 }; index < COLUMNS; ++index) {
+         if (program_config.select_columns[index] != -1
+           && static_cast<size_t>(program_config.select_columns[index])
+             >= columns.size()) {
+            // Warn if a bar has fewer columns than specified
+            ostringstream oss;
+            oss << "One of the bars in the " << block.number
+                << " bar chart has fewer columns than specified";
+            result.warnings.push_back(oss.str());
+            restart_for = true;
+            break;
+         }
+      }
+
+      if (restart_for) {
+         continue;
+      }
+
+      if (result.bar_number == 0) {
+         // Set the time stamp of the bar chart from the first column
+         result.bar_chart.setTimeStamp(
+           string(columns[program_config.select_columns[0]]));
+      }
+
+      uint32_t other_info { 0 };
+
+      if (program_config.select_columns[2] != -1) {
+         other_info = cache.intern(columns[program_config.select_columns[2]]);
+      }
+
+      double long value;
+      ParseStatus status;
+
+      {
+         PROFILE_SCOPE(PHASE_PARSE);
+         status = parseLongDouble(
+           columns[program_config.select_columns[3]], value);
+      }
+
+      if (status != PARSE_OK) {
+         // Values that are not numbers are drawn as 0, as stold failing did
+         value = 0;
+
+         if (status == PARSE_INVALID) {
+            ++invalid_values;
+         } else {
+            ++out_of_range_values;
+         }
+      } else if (!std::isfinite(value)) {
+         // Infinities and NaN are kept, as stold accepts them
+         ++not_finite_values;
+      }
+
+      uint32_t category;
+
+      {
+         PROFILE_SCOPE(PHASE_CATEGORIES);
+         category = cache.intern(columns[program_config.select_columns[4]]);
+
+         if (categories_found.insert(category).second) {
+            result.categories.push_back(category);
+         }
+      }
+
+      // Create and add a bar to the current bar chart
+      Bar bar { cache.intern(columns[program_config.select_columns[1]]),
+         other_info,
+         category,
+         value };
+
+      result.bar_chart.addBar(&bar);
+
+      ++result.bar_number;
+   }
+
+   if (program_config.value_warnings) {
+      // Warn about the values that could not be parsed, only when asked, as
+      // they never were
+      auto const warnValues { [&](int count, char const* reason) {
+         if (count != 0) {
+            ostringstream oss;
+            oss << count << " of the bars in the " << block.number
+                << " bar chart have a value " << reason;
+            result.warnings.push_back(oss.str());
+         }
+      } };
+
+      warnValues(invalid_values,
+        "that is not a number. The value 0 will be set.");
+      warnValues(out_of_range_values,
+        "out of range. The value 0 will be set.");
+      warnValues(not_finite_values, "that is infinite or NaN.");
+   }
+
+   if (block.short_block) {
+      ostringstream oss;
+      oss << "The Number Bar chart " << block.number
+          << " has less data than specified.";
+      result.warnings.push_back(oss.str());
+   }
+}
+
+// Add a built block to the Database
+shared_ptr<BarChart> DataLoader::addBlock(
+  BlockResult& result, Database& database, vector<string>& warnings) {
+   PROFILE_SCOPE(PHASE_FRAME_BUILD);
+
+   for (string& warning : result.warnings) {
+      warnings.push_back(std::move(warning));
+   }
+
+   {
+      PROFILE_SCOPE(PHASE_CATEGORIES);
+
+      for (uint32_t category : result.categories) {
+         short color { green };
+         if (program_config.colors) {
+            // Set color based on configuration
+            color = LIST_OF_COLORS[categories % NUMBER_OF_COLORS];
+         }
+
+         if (database.addCategory(category, color)) {
+            // Add category to the database and track the number of
+            // categories
+            ++categories;
+         }
+      }
+   }
+
+   if (max_number_of_bars < result.bar_number) {
+      // Update the maximum number of bars encountered
+      max_number_of_bars = result.bar_number;
+   }
+
+   // Rank the bar chart from the order of the previous one, in file order
+   ranker.rank(result.bar_chart);
+
+   // Add the completed bar chart to the database
+   return database.addBarChart(&result.bar_chart);
+}
+
+// Check if a given string holds only an integer, indicating a quantity
+bool DataLoader::isQuantify(string_view line, int& quantify) {
+   return isInteger(line, quantify);
+}
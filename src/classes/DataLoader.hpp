@@ -0,0 +1,217 @@
+/**
+ * @file DataLoader.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Defines the DataLoader class, which builds a Database from the lines
+ * of a data file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The data file is a header followed by a sequence of blocks: a count line and
+ * that many rows. The DataLoader splits the input into blocks with a single
+ * scan and turns each block into a BarChart. Since blocks are independent,
+ * they can be built by several threads and stitched back into the Database in
+ * file order.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef DATA_LOADER_HPP_
+#define DATA_LOADER_HPP_
+
+#include "Database.hpp"
+#include "FrameRanker.hpp"
+#include "linereader.hpp"
+#include "utils.hpp"
+
+#include "fstring.hpp" /// splitWithEmpty, green
+using fos::splitWithEmpty;
+using fos::foreground::green;
+
+#include "parsing.hpp" /// isInteger, parseLongDouble, ParseStatus, PARSE_OK, PARSE_INVALID
+using prs::isInteger;
+using prs::parseLongDouble;
+using prs::ParseStatus;
+using prs::PARSE_OK;
+using prs::PARSE_INVALID;
+
+#include <string> /// string
+using std::string;
+
+#include <string_view> /// string_view
+using std::string_view;
+
+#include <vector> /// vector
+using std::vector;
+
+#include <deque> /// deque
+using std::deque;
+
+#include <sstream> /// ostringstream
+using std::ostringstream;
+
+#include <atomic> /// atomic
+using std::atomic;
+
+#include <thread> /// thread, hardware_concurrency
+using std::thread;
+
+constexpr short HEADER_SIZE { 3 }; ///< Header size >//
+constexpr size_t MINIMUM_RECLAIM {
+   65536
+}; ///< Strings interned before the first reclaim of a stream >//
+
+short const LIST_OF_COLORS[NUMBER_OF_COLORS] = {
+   fos::foreground::red,
+   fos::foreground::green,
+   fos::foreground::yellow,
+   fos::foreground::blue,
+   fos::foreground::magenta,
+   fos::foreground::cyan,
+   fos::foreground::white,
+   fos::foreground::bright_red,
+   fos::foreground::bright_green,
+   fos::foreground::bright_yellow,
+   fos::foreground::bright_blue,
+   fos::foreground::bright_magenta,
+   fos::foreground::bright_cyan,
+   fos::foreground::bright_white,
+}; ///< List of colors used in categories >//
+
+/**
+ * @brief Rows of the data file that make up a single bar chart
+ */
+struct DataBlock {
+   int number { 0 }; ///< Position of the block in the data file
+   vector<string_view> rows; ///< Rows of the block, in file order
+   bool short_block { false }; ///< The block has less rows than specified
+   deque<string> storage; ///< Copies of rows read from unstable sources
+};
+
+/**
+ * @brief Bar chart built from a block, waiting to be added to the Database
+ */
+struct BlockResult {
+   BarChart bar_chart; ///< The bar chart built from the block
+   vector<string> warnings; ///< Warnings raised while building the block
+   vector<uint32_t>
+     categories; ///< StringPool ids of the categories, in order of first
+                 ///< appearance
+   int bar_number { 0 }; ///< Number of bars added to the bar chart
+};
+
+/**
+ * @brief DataLoader class that fills a Database from a data file
+ */
+class DataLoader {
+   public:
+   /**
+    * @brief Constructor for the DataLoader class
+    * @param program_config_ Program configuration used to read the columns
+    * and the number of threads
+    */
+   DataLoader(ProgramConfig const& program_config_)
+       : program_config(program_config_)
+       , ranker(program_config_.number_of_bars, program_config_.ticks) { }
+
+   /**
+    * @brief Read the header and every bar chart of the data into a Database
+    *
+    * When more than one thread is configured, the blocks are first located
+    * by a scan of the whole input and then built concurrently. Warnings are
+    * the same as with a single thread.
+    *
+    * @param reader The source of lines of the data
+    * @param database The Database that receives the data
+    * @param warnings The list that receives the warnings
+    */
+   void load(LineReader& reader, Database& database, vector<string>& warnings);
+
+   /**
+    * @brief Read the title, scale and source of the data into a Database
+    * @param reader The source of lines of the data
+    * @param database The Database that receives the header
+    */
+   void loadHeader(LineReader& reader, Database& database);
+
+   /**
+    * @brief Read every bar chart of the data into a Database
+    * @param reader The source of lines of the data, after the header
+    * @param database The Database that receives the bar charts
+    * @param warnings The list that receives the warnings
+    * @param _frames Queue that also receives each bar chart as soon as it is
+    * added, closed at the end (default: nullptr). Bar charts are then built
+    * by a single thread, in order, and once the strings interned double, the
+    * ones of the bar charts no longer kept by the Database are reclaimed.
+    * @return true if every block of the input was read, false if the queue
+    * was closed before
+    */
+   bool loadBlocks(LineReader& reader, Database& database,
+     vector<string>& warnings, FrameQueue* _frames = nullptr);
+
+   /**
+    * @brief Get the maximum number of bars found in a bar chart
+    * @return Maximum number of bars
+    */
+   short getMaxNumberOfBars() const;
+
+   /**
+    * @brief Check if a line contains a "quantify" command
+    * @param line The line to check
+    * @param quantify Receives the quantity (unchanged unless it returns true)
+    * @return true if the line contains a "quantify" command, false otherwise
+    */
+   static bool isQuantify(string_view line, int& quantify);
+
+   private:
+   ProgramConfig const& program_config; ///< Program configuration
+   atomic<short> max_number_of_bars { 0 }; ///< Maximum number of bars
+   int categories { 0 }; ///< Number of categories found
+   FrameRanker ranker; ///< Ranks the bars drawn of each bar chart, in file order
+   size_t reclaim_at {
+      MINIMUM_RECLAIM
+   }; ///< Strings in the pool that trigger the next reclaim when streaming
+
+   // State of the block scan
+   string_view line; ///< Last line read
+   int block_number { 0 }; ///< Number of the next block
+   bool line_error { false }; ///< A short block read the next count line
+   int quantify_buffer { 0 }; ///< Count read by the last short block
+
+   /**
+    * @brief Get the number of threads used to build the blocks
+    * @return Number of threads (at least 1)
+    */
+   unsigned getNumberOfThreads() const;
+
+   /**
+    * @brief Read the rows of the next block
+    * @param reader The source of lines of the data
+    * @param block The block that receives the rows
+    * @return true if a block was read, false at the end of the input
+    */
+   bool nextBlock(LineReader& reader, DataBlock& block);
+
+   /**
+    * @brief Build the bar chart of a block
+    *
+    * This function does not touch the state of the loader, so several blocks
+    * can be built at the same time.
+    *
+    * @param block The block to build
+    * @param result The result that receives the bar chart and the warnings
+    */
+   void buildBlock(DataBlock const& block, BlockResult& result) const;
+
+   /**
+    * @brief Add a built block to the Database
+    * @param result The block to add
+    * @param database The Database that receives the block
+    * @param warnings The list that receives the warnings of the block
+    * @return Shared pointer to the bar chart stored in the Database
+    */
+   shared_ptr<BarChart> addBlock(
+     BlockResult& result, Database& database, vector<string>& warnings);
+};
+
+#endif /// DATA_LOADER_HPP_
@@ -14,6 +14,8 @@
 
 #include "Database.hpp"
 
+#include "profiler.hpp" /// PROFILE_SCOPE
+
 Database::~Database() {
    // Destructor implementation
 }
@@ -34,81 +36,578 @@ string Database::getSource() const {
 }
 
 // Function to get the categories stored in the database
-map<string, short> Database::getCategories() const {
+vector<uint32_t> Database::getCategories() const {
+   lock_guard<mutex> lock { data_mutex };
+   return category_names;
+}
+
+// Function to get the colors of the categories stored in the database
+vector<short> Database::getCategoryColors() const {
+   lock_guard<mutex> lock { data_mutex };
    return categories;
 }
 
+// Function to get the number of categories stored in the database
+size_t Database::getNumberOfCategories() const {
+   lock_guard<mutex> lock { data_mutex };
+   return category_names.size();
+}
+
 // Function to get the bar charts stored in the database
 vector<shared_ptr<BarChart>> Database::getBarCharts() const {
-   return bar_charts;
+   lock_guard<mutex> lock { data_mutex };
+   vector<shared_ptr<BarChart>> stored;
+   stored.reserve(bar_charts.size());
+
+   for (size_t index { 0 }; index != bar_charts.size(); ++index) {
+      stored.push_back(bar_charts[index]);
+   }
+
+   return stored;
+}
+
+// Function to get the number of bar charts stored in the database
+size_t Database::getNumberOfBarCharts() const {
+   lock_guard<mutex> lock { data_mutex };
+   return bar_charts.getTotal();
+}
+
+// Function to check if every bar chart added is still stored
+bool Database::isComplete() const {
+   lock_guard<mutex> lock { data_mutex };
+   return bar_charts.getTotal() == bar_charts.size();
+}
+
+// Function to set the number of bar charts kept in the database
+void Database::setHistory(size_t history) {
+   lock_guard<mutex> lock { data_mutex };
+   bar_charts.reset(history);
 }
 
 // Function to set the title of the database
 void Database::setTitle(string title_) {
    title = title_;
+   frame_layout = FrameLayout();
 }
 
 // Function to set the scale of the database
 void Database::setScale(string scale_) {
    scale = scale_;
+   frame_layout = FrameLayout();
 }
 
 // Function to set the source of the database
 void Database::setSource(string source_) {
    source = source_;
+   frame_layout = FrameLayout();
 }
 
 // Function to add a category to the database
 bool Database::addCategory(string text, short color) {
-   if (categories.find(text) == categories.end()) {
-      categories[text] = color;
-      if (categories.size() > NUMBER_OF_COLORS) {
-         for (auto& category : categories) {
-            category.second = fos::foreground::green;
-         }
+   return addCategory(StringPool::getInstance().intern(text), color);
+}
+
+// Function to add an interned category to the database
+bool Database::addCategory(uint32_t id, short color) {
+   lock_guard<mutex> lock { data_mutex };
+
+   if (id < categories.size() && categories[id] != NO_CATEGORY) {
+      return false;
+   }
+
+   if (id >= categories.size()) {
+      categories.resize(id + 1, NO_CATEGORY);
+   }
+
+   categories[id] = color;
+
+   // Keep the names sorted, as the legend shows them
+   StringPool const& pool { StringPool::getInstance() };
+   string_view const name { pool.resolve(id) };
+   category_names.insert(std::lower_bound(category_names.begin(),
+                           category_names.end(),
+                           name,
+                           [&pool](uint32_t other, string_view text) -> bool {
+                              return pool.resolve(other) < text;
+                           }),
+     id);
+
+   if (category_names.size() > NUMBER_OF_COLORS) {
+      for (uint32_t category : category_names) {
+         categories[category] = fos::foreground::green;
       }
-      return true;
    }
 
-   return false;
+   return true;
 }
 
-// Function to add a category to the database
-void Database::addBarChart(BarChart const* bar_chart) {
-   if (bar_chart) {
-      shared_ptr<BarChart> ptr { make_shared<BarChart>(*bar_chart) };
-      bar_charts.push_back(ptr);
+// Function to add a bar chart to the database
+shared_ptr<BarChart> Database::addBarChart(BarChart const* bar_chart) {
+   if (!bar_chart) {
+      return nullptr;
    }
+
+   size_t const length { bar_chart->getNumberOfBars() };
+
+   lock_guard<mutex> lock { data_mutex };
+
+   if (!chunk || chunk->values.size() + length > chunk->values.capacity()) {
+      // Start new columns instead of moving the ones already viewed
+      if (chunk) {
+         past_chunks.push_back(chunk);
+      }
+
+      chunk = make_shared<BarColumns>();
+      chunk->reserve(std::max(BARS_PER_CHUNK, length));
+   }
+
+   size_t const first { chunk->values.size() };
+
+   if (length != 0) {
+      chunk->append(*bar_chart->getColumns(), bar_chart->getFirst(), length);
+   }
+
+   shared_ptr<BarChart> ptr { make_shared<BarChart>(
+     bar_chart->getTimeStamp(),
+     chunk,
+     first,
+     length,
+     bar_chart->getNumberOfOrderedBars()) };
+   bar_charts.push_back(ptr);
+
+   return ptr;
 }
 
-// Function to add a category to the database
-void Database::draw(short fps, short bar_size, short _view_bars, short _ticks,
-  short _terminal_size) const {
-   for (shared_ptr<BarChart> bar_chart : bar_charts) {
-      std::chrono::milliseconds time(1000 / fps);
-      std::this_thread::sleep_for(time);
+// Function to add a bar chart to the database without copying its bars
+void Database::adoptBarChart(shared_ptr<BarChart> bar_chart) {
+   if (!bar_chart) {
+      return;
+   }
 
-      string buffer { title };
+   lock_guard<mutex> lock { data_mutex };
+   shared_ptr<BarColumns const> const columns { bar_chart->getColumns() };
 
-      if (_terminal_size != 0) {
-         buffer = columnWrap(buffer, _terminal_size);
-         buffer = alignment(buffer, _terminal_size, center, " ");
+   if (past_chunks.empty() || past_chunks.back().lock() != columns) {
+      past_chunks.push_back(columns);
+   }
+
+   bar_charts.push_back(bar_chart);
+}
+
+// Function to free the strings of the bar charts no longer in memory
+size_t Database::reclaimStrings() const {
+   StringPool& pool { StringPool::getInstance() };
+   lock_guard<mutex> lock { data_mutex };
+
+   if (bar_charts.getCapacity() == 0) {
+      // Every bar chart is kept, and so is every string
+      return pool.size();
+   }
+
+   vector<bool> live;
+
+   auto const mark { [&live](uint32_t id) {
+      if (id >= live.size()) {
+         live.resize(id + 1, false);
+      }
+
+      live[id] = true;
+   } };
+
+   for (uint32_t category : category_names) {
+      mark(category);
+   }
+
+   auto const markColumns { [&mark](BarColumns const& columns) {
+      for (size_t index { 0 }; index != columns.values.size(); ++index) {
+         mark(columns.labels[index]);
+         mark(columns.infos[index]);
+         mark(columns.categories[index]);
+      }
+   } };
+
+   if (chunk) {
+      markColumns(*chunk);
+   }
+
+   // Columns no bar chart views anymore are forgotten
+   size_t kept { 0 };
+
+   for (weak_ptr<BarColumns const>& past : past_chunks) {
+      if (shared_ptr<BarColumns const> const columns { past.lock() }) {
+         markColumns(*columns);
+         past_chunks[kept++] = std::move(past);
       }
+   }
+
+   past_chunks.resize(kept);
 
-      cout << setStyle(buffer, blue, -1, bold) << "\n\n";
+   return pool.reclaim(live);
+}
+
+// Function to draw every bar chart of the database
+void Database::draw(FrameBuffer& frame, FramePacer& pacer, short bar_size,
+  short _view_bars, short _ticks, short _terminal_size, short _tween_frames,
+  unsigned _render_threads) const {
+   vector<shared_ptr<BarChart>> const stored { getBarCharts() };
+
+   if (_render_threads > 1 && stored.size() > 1) {
+      drawInParallel(frame,
+        pacer,
+        stored,
+        _render_threads,
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size,
+        _tween_frames);
+      return;
+   }
+
+   FrameTweener tweener;
+
+   // Frames are no longer composed once the output failed
+   for (size_t index { 0 }; index != stored.size() && !frame.hasFailed();
+        ++index) {
+      drawKeyframe(frame,
+        pacer,
+        tweener,
+        index != 0 ? stored[index - 1].get() : nullptr,
+        *stored[index],
+        index + 1 == stored.size(),
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size,
+        _tween_frames);
+   }
+}
+
+// Function to draw the bar charts received from a queue
+void Database::draw(FrameQueue& frames, FrameBuffer& frame,
+  FramePacer& pacer, short bar_size, short _view_bars, short _ticks,
+  short _terminal_size, short _tween_frames) const {
+   shared_ptr<BarChart> previous;
+   shared_ptr<BarChart> bar_chart;
+   FrameTweener tweener;
+
+   while (!frame.hasFailed() && frames.pop(bar_chart)) {
+      // Without a newer bar chart waiting, this one may be the last
+      bool const newest { frames.empty() };
+
+      drawKeyframe(frame,
+        pacer,
+        tweener,
+        previous.get(),
+        *bar_chart,
+        newest,
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size,
+        _tween_frames);
+      previous = bar_chart;
+   }
+}
+
+// Function to compose the frames on a pool of threads and write them in order
+void Database::drawInParallel(FrameBuffer& frame, FramePacer& pacer,
+  vector<shared_ptr<BarChart>> const& stored, unsigned threads,
+  short bar_size, short _view_bars, short _ticks, short _terminal_size,
+  short _tween_frames) const {
+   /// Frames of a bar chart, composed by a worker and written in order
+   struct Slot {
+      vector<string> frames; ///< Bytes of each frame
+      size_t count { 0 }; ///< Number of frames composed
+      bool ready { false }; ///< The frames wait to be written
+   };
+
+   // Only a window of bar charts is in flight, so memory stays bounded
+   size_t const window { threads * RENDER_WINDOW_PER_THREAD };
+   vector<Slot> slots(window);
+   size_t next_job { 0 };
+   size_t written { 0 };
+   mutex slots_mutex;
+   condition_variable composed;
+   condition_variable consumed;
+
+   // The bar charts are complete, so the categories do not change anymore
+   FrameLayout layout;
+   layOut(layout, _terminal_size);
+
+   // The images of a video are drawn by the workers, sized after the first
+   // frame, so the writer only copies them to the output
+   bool const video { frame.isVideo() };
+
+   if (video) {
+      FrameBuffer first;
+      FrameLayout first_layout { layout };
+      composeFrame(first,
+        *stored[0],
+        first_layout,
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size);
+      frame.fit(first.getFrame());
+   }
 
-      bar_chart->draw(bar_size, _view_bars, _ticks, _terminal_size, categories);
+   vector<unique_ptr<FrameBuffer>> composers;
 
-      cout << setStyle(scale, yellow, -1, bold) << "\n\n";
-      cout << setStyle(source, -1, -1, bold) << "\n";
+   for (unsigned worker { 0 }; worker != threads; ++worker) {
+      composers.push_back(make_unique<FrameBuffer>());
 
-      if (categories.size() <= NUMBER_OF_COLORS) {
-         for (auto category : categories) {
-            cout << setStyle("\u2588", category.second, -1, bold) << ": ";
-            cout << setStyle(category.first, category.second, -1, bold) << " ";
+      if (video) {
+         composers.back()->setFormatOf(frame);
+      }
+   }
+
+   auto const work { [&](FrameBuffer& composer) {
+      FrameTweener tweener;
+      FrameLayout worker_layout { layout };
+      vector<string> frames;
+
+      for (;;) {
+         size_t job;
+
+         {
+            unique_lock<mutex> lock { slots_mutex };
+            consumed.wait(lock, [&]() {
+               return next_job >= stored.size() || next_job < written + window;
+            });
+
+            if (next_job >= stored.size()) {
+               return;
+            }
+
+            job = next_job++;
+         }
+
+         BarChart const& bar_chart { *stored[job] };
+         size_t count { 1 };
+
+         if (job != 0 && _tween_frames > 1) {
+            tweener.setKeyframes(
+              *stored[job - 1], bar_chart, _view_bars, _ticks);
+            count = _tween_frames;
          }
+
+         if (frames.size() < count) {
+            frames.resize(count);
+         }
+
+         for (size_t step { 1 }; step <= count; ++step) {
+            composer.begin();
+            composeFrame(composer,
+              count == 1 ? bar_chart
+                         : tweener.at(static_cast<double>(step) / count),
+              worker_layout,
+              bar_size,
+              _view_bars,
+              _ticks,
+              _terminal_size);
+
+            if (video) {
+               composer.encode(frames[step - 1]);
+            } else {
+               frames[step - 1].assign(composer.getFrame());
+            }
+         }
+
+         {
+            lock_guard<mutex> lock { slots_mutex };
+            Slot& slot { slots[job % window] };
+            slot.frames.swap(frames);
+            slot.count = count;
+            slot.ready = true;
+         }
+
+         composed.notify_all();
       }
+   } };
 
-      cout << "\n\n";
+   vector<thread> workers;
+
+   for (unsigned worker { 0 }; worker != threads; ++worker) {
+      workers.emplace_back(work, std::ref(*composers[worker]));
    }
-}
\ No newline at end of file
+
+   // Write the frames in order as they are composed
+   vector<string> frames;
+
+   for (size_t job { 0 }; job != stored.size(); ++job) {
+      size_t count;
+
+      {
+         unique_lock<mutex> lock { slots_mutex };
+         Slot& slot { slots[job % window] };
+         composed.wait(lock, [&slot]() { return slot.ready; });
+
+         // Leave the buffers of the frames written last in the slot, to reuse
+         frames.swap(slot.frames);
+         count = slot.count;
+         slot.ready = false;
+         written = job + 1;
+      }
+
+      consumed.notify_all();
+
+      for (size_t index { 0 }; index != count && !frame.hasFailed();
+           ++index) {
+         pacer.wait(job + 1 == stored.size() && index + 1 == count);
+         frame.begin(pacer.getPresentationTime());
+
+         if (video) {
+            frame.flushEncoded(frames[index]);
+         } else {
+            frame << frames[index];
+            frame.flush();
+         }
+
+         pacer.present();
+      }
+
+      if (frame.hasFailed()) {
+         // Stop the workers, the bar charts left are not composed
+         {
+            lock_guard<mutex> lock { slots_mutex };
+            next_job = stored.size();
+         }
+
+         consumed.notify_all();
+         break;
+      }
+   }
+
+   for (thread& worker : workers) {
+      worker.join();
+   }
+}
+
+// Function to draw the frames that lead from a bar chart to the next one
+void Database::drawKeyframe(FrameBuffer& frame, FramePacer& pacer,
+  FrameTweener& tweener, BarChart const* previous, BarChart const& bar_chart,
+  bool last, short bar_size, short _view_bars, short _ticks,
+  short _terminal_size, short _tween_frames) const {
+   if (previous == nullptr || _tween_frames <= 1) {
+      drawFrame(frame,
+        pacer,
+        bar_chart,
+        last,
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size);
+      return;
+   }
+
+   tweener.setKeyframes(*previous, bar_chart, _view_bars, _ticks);
+
+   for (short step { 1 }; step <= _tween_frames && !frame.hasFailed();
+        ++step) {
+      drawFrame(frame,
+        pacer,
+        tweener.at(static_cast<double>(step) / _tween_frames),
+        last && step == _tween_frames,
+        bar_size,
+        _view_bars,
+        _ticks,
+        _terminal_size);
+   }
+}
+
+// Function to wait for the deadline of the next frame and draw a bar chart
+void Database::drawFrame(FrameBuffer& frame, FramePacer& pacer,
+  BarChart const& bar_chart, bool last, short bar_size, short _view_bars,
+  short _ticks, short _terminal_size) const {
+   if (!pacer.wait(last)) {
+      // Too late to be drawn
+      return;
+   }
+
+   // Compose the whole frame, then write it at once
+   frame.begin(pacer.getPresentationTime());
+
+   // Categories may still be added by the parser
+   layOut(frame_layout, _terminal_size);
+
+   composeFrame(frame,
+     bar_chart,
+     frame_layout,
+     bar_size,
+     _view_bars,
+     _ticks,
+     _terminal_size);
+
+   frame.flush();
+   pacer.present();
+}
+
+// Function to lay out the parts of the frames that do not change
+void Database::layOut(FrameLayout& layout, short _terminal_size) const {
+   lock_guard<mutex> lock { data_mutex };
+
+   if (layout.terminal_size == _terminal_size
+     && layout.categories == category_names.size()) {
+      return;
+   }
+
+   layout.terminal_size = _terminal_size;
+   layout.categories = category_names.size();
+   layout.colors = categories;
+   layout.time_stamp_line.clear();
+
+   string buffer { title };
+
+   if (_terminal_size != 0) {
+      string wrapped;
+      appendColumnWrap(wrapped, buffer, _terminal_size);
+      buffer.clear();
+      appendAlignment(buffer, wrapped, _terminal_size, center);
+   }
+
+   layout.header = setStyle(buffer, blue, -1, bold) + "\n\n";
+
+   layout.footer = setStyle(scale, yellow, -1, bold) + "\n\n";
+   layout.footer += setStyle(source, -1, -1, bold) + "\n";
+
+   if (category_names.size() <= NUMBER_OF_COLORS) {
+      StringPool const& pool { StringPool::getInstance() };
+
+      for (uint32_t category : category_names) {
+         short const color { categories[category] };
+         layout.footer += setStyle("\u2588", color, -1, bold) + ": ";
+         layout.footer +=
+           setStyle(string(pool.resolve(category)), color, -1, bold) + " ";
+      }
+   }
+
+   layout.footer += "\n\n";
+}
+
+// Function to append the whole frame of a bar chart to a buffer
+void Database::composeFrame(FrameBuffer& frame, BarChart const& bar_chart,
+  FrameLayout& layout, short bar_size, short _view_bars, short _ticks,
+  short _terminal_size) const {
+   PROFILE_SCOPE(PHASE_DATABASE_DRAW);
+
+   frame << layout.header;
+
+   // Tween frames and repeated time stamps reuse the line of the last one
+   string const time_stamp { bar_chart.getTimeStamp() };
+
+   if (time_stamp != layout.time_stamp || layout.time_stamp_line.empty()) {
+      layout.time_stamp = time_stamp;
+      layout.time_stamp_line = bar_chart.getTimeStampLine(_terminal_size);
+   }
+
+   frame << layout.time_stamp_line;
+
+   {
+      PROFILE_SCOPE(PHASE_CHART_DRAW);
+      bar_chart.drawBars(
+        frame, bar_size, _view_bars, _ticks, _terminal_size, layout.colors);
+   }
+
+   frame << layout.footer;
+}
@@ -17,6 +17,7 @@
 #define DATABASE_HPP_
 
 #include "BarChart.hpp"
+#include "FrameTweener.hpp"
 
 #include <vector> /// vector
 using std::vector;
@@ -24,22 +25,39 @@ using std::vector;
 #include <string> /// string
 using std::string;
 
-#include <memory> /// shared_ptr, make_shared
+#include <memory> /// shared_ptr, make_shared, unique_ptr, make_unique, weak_ptr
 using std::make_shared;
+using std::make_unique;
 using std::shared_ptr;
+using std::unique_ptr;
+using std::weak_ptr;
 
-#include <map> /// map
-using std::map;
+#include <cstdint> /// uint32_t
 
-#include <iostream> /// iostream
-using std::cout;
+#include <algorithm> /// lower_bound, max
 
-#include <chrono>
-#include <thread>
+#include "framebuffer.hpp" /// FrameBuffer
+#include "framepacer.hpp" /// FramePacer
 
-#include "fstring.hpp" /// alignment, columnWrap, setStyle, center, blue, yellow, bold
-using fos::alignment;
-using fos::columnWrap;
+#include <mutex> /// mutex, lock_guard, unique_lock
+using std::lock_guard;
+using std::mutex;
+using std::unique_lock;
+
+#include <condition_variable> /// condition_variable
+using std::condition_variable;
+
+#include <thread> /// thread
+using std::thread;
+
+#include <functional> /// ref
+
+#include "boundedqueue.hpp" /// BoundedQueue
+#include "ringbuffer.hpp" /// RingBuffer
+
+#include "fstring.hpp" /// appendAlignment, appendColumnWrap, setStyle, center, blue, yellow, bold
+using fos::appendAlignment;
+using fos::appendColumnWrap;
 using fos::setStyle;
 using fos::align::center;
 using fos::foreground::blue;
@@ -48,6 +66,30 @@ using fos::style::bold;
 
 ///< Definition of system constants >//
 constexpr short NUMBER_OF_COLORS { 14 }; ///< Number of colors >//
+constexpr size_t BARS_PER_CHUNK {
+   16384
+}; ///< Bars reserved at once by the frame store >//
+constexpr size_t RENDER_WINDOW_PER_THREAD {
+   4
+}; ///< Bar charts composed ahead of the writer by each render thread >//
+
+/// Queue of bar charts handed from the parser to the animation
+using FrameQueue = BoundedQueue<shared_ptr<BarChart>>;
+
+/**
+ * @struct FrameLayout
+ * @brief The parts of a frame that do not change from one bar chart to the
+ * next, styled once for a terminal size and a set of categories
+ */
+struct FrameLayout {
+   short terminal_size { -1 }; ///< Terminal size laid out for (-1: none)
+   size_t categories { 0 }; ///< Number of categories laid out
+   vector<short> colors; ///< Color of each category, indexed by StringPool id
+   string header; ///< Styled title, followed by a blank line
+   string footer; ///< Styled scale and source, legend and blank line
+   string time_stamp; ///< Time stamp of the last bar chart drawn
+   string time_stamp_line; ///< Styled line of that time stamp
+};
 
 /**
  * @class Database
@@ -55,7 +97,8 @@ constexpr short NUMBER_OF_COLORS { 14 }; ///< Number of colors >//
  *
  * The Database class provides functionality for storing information about bar
  * charts, including their titles, scales, sources, categories, and actual bar
- * chart data.
+ * chart data. Categories and bar charts can be added by a parser thread while
+ * another thread draws.
  */
 class Database {
    public:
@@ -98,16 +141,49 @@ class Database {
 
    /**
     * @brief Get the categories stored in the database
-    * @return A map of category names to colors
+    * @return The StringPool ids of the categories, sorted by name
     */
-   map<string, short> getCategories() const;
+   vector<uint32_t> getCategories() const;
+
+   /**
+    * @brief Get the colors of the categories stored in the database
+    * @return The color of each category indexed by its StringPool id, with
+    * NO_CATEGORY for the ids that are not categories
+    */
+   vector<short> getCategoryColors() const;
+
+   /**
+    * @brief Get the number of categories stored in the database
+    * @return Number of categories
+    */
+   size_t getNumberOfCategories() const;
 
    /**
     * @brief Get the bar charts stored in the database
-    * @return A vector of shared pointers to BarChart objects
+    * @return A vector of shared pointers to BarChart objects, oldest first
     */
    vector<shared_ptr<BarChart>> getBarCharts() const;
 
+   /**
+    * @brief Get the number of bar charts added to the database, including
+    * the ones no longer stored
+    * @return Number of bar charts
+    */
+   size_t getNumberOfBarCharts() const;
+
+   /**
+    * @brief Check if every bar chart added to the database is still stored
+    * @return true if no bar chart was dropped from the history
+    */
+   bool isComplete() const;
+
+   /**
+    * @brief Set the number of bar charts kept in the database, removing the
+    * stored ones
+    * @param history Number of most recent bar charts kept (0 keeps all)
+    */
+   void setHistory(size_t history);
+
    /**
     * @brief Set the title of the database
     * @param title_ The new title for the database
@@ -134,22 +210,76 @@ class Database {
     */
    bool addCategory(string text, short color);
 
+   /**
+    * @brief Add an interned category to the database
+    * @param id The StringPool id of the name of the category
+    * @param color The color associated with the category
+    * @return True if the category was added successfully, false otherwise
+    */
+   bool addCategory(uint32_t id, short color);
+
    /**
     * @brief Add a bar chart to the database
     * @param bar_chart A pointer to a BarChart object to add
+    * @return Shared pointer to the stored copy (null if bar_chart is null)
     */
-   void addBarChart(BarChart const* bar_chart);
+   shared_ptr<BarChart> addBarChart(BarChart const* bar_chart);
+
+   /**
+    * @brief Add a bar chart to the database without copying its bars
+    * @param bar_chart The bar chart, whose columns are not changed anymore
+    */
+   void adoptBarChart(shared_ptr<BarChart> bar_chart);
+
+   /**
+    * @brief Free the interned strings that only bar charts no longer in
+    * memory referred to
+    *
+    * The categories and the bars of every column still viewed, by a stored
+    * bar chart or by one being drawn, are kept. Nothing is freed while every
+    * bar chart is kept. Must be called by the only thread interning strings.
+    *
+    * @return Number of strings left in the StringPool
+    */
+   size_t reclaimStrings() const;
 
    /**
     * @brief Draw the database's content with customizable parameters
-    * @param fps Frames per second for the drawing
+    * @param frame The buffer that composes and writes each frame
+    * @param pacer The scheduler of the frames, already started
     * @param bar_size Size of the bars in the chart
     * @param _view_bars Number of bars to display (0 to show all)
     * @param _ticks Number of ticks to display (0 for none)
     * @param _terminal_size Terminal size for proper formatting (0 for default)
+    * @param _tween_frames Frames drawn from a bar chart to the next one (1 to
+    * draw each bar chart once)
+    * @param _render_threads Threads composing the frames ahead of the one
+    * writing them, for a pacer that does not wait (1 composes them in turn)
     */
-   void draw(short fps, short bar_size, short _view_bars = 0, short _ticks = 0,
-     short _terminal_size = 0) const;
+   void draw(FrameBuffer& frame, FramePacer& pacer, short bar_size,
+     short _view_bars = 0, short _ticks = 0, short _terminal_size = 0,
+     short _tween_frames = 1, unsigned _render_threads = 1) const;
+
+   /**
+    * @brief Draw the bar charts received from a queue until it is closed
+    *
+    * Each bar chart is drawn as soon as it is received. A bar chart with no
+    * other one waiting in the queue is the newest known, so the pacer never
+    * drops it, and the last one is always drawn.
+    *
+    * @param frames Queue of the bar charts to draw, in order
+    * @param frame The buffer that composes and writes each frame
+    * @param pacer The scheduler of the frames, already started
+    * @param bar_size Size of the bars in the chart
+    * @param _view_bars Number of bars to display (0 to show all)
+    * @param _ticks Number of ticks to display (0 for none)
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    * @param _tween_frames Frames drawn from a bar chart to the next one (1 to
+    * draw each bar chart once)
+    */
+   void draw(FrameQueue& frames, FrameBuffer& frame, FramePacer& pacer,
+     short bar_size, short _view_bars = 0, short _ticks = 0,
+     short _terminal_size = 0, short _tween_frames = 1) const;
 
    private:
    string title; ///< Title of the database
@@ -158,10 +288,102 @@ class Database {
 
    string source; ///< Source of the database
 
-   map<string, short> categories; ///< Map of category names to colors
+   vector<short>
+     categories; ///< Color of each category, indexed by StringPool id
+
+   vector<uint32_t>
+     category_names; ///< StringPool ids of the categories, sorted by name
+
+   RingBuffer<shared_ptr<BarChart>>
+     bar_charts; ///< Most recent bar charts, oldest first
+
+   shared_ptr<BarColumns>
+     chunk; ///< Columns receiving the bars of the new bar charts
+
+   mutable vector<weak_ptr<BarColumns const>>
+     past_chunks; ///< Columns of the bar charts added, which may still be
+                  ///< viewed
+
+   mutable mutex data_mutex; ///< Mutex guarding categories and bar charts
+
+   mutable FrameLayout
+     frame_layout; ///< Layout of the frames drawn on the calling thread
+
+   /**
+    * @brief Lay out the parts of the frames that do not change, unless they
+    * are laid out for the same terminal size and categories already
+    * @param layout The layout to update
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    */
+   void layOut(FrameLayout& layout, short _terminal_size) const;
+
+   /**
+    * @brief Compose the frames of the bar charts on a pool of threads and
+    * write them in order, with a bounded number of bar charts in flight
+    * @param frame The buffer that writes the frames
+    * @param pacer The scheduler of the frames, which must not wait
+    * @param stored The bar charts to draw, in order
+    * @param threads Number of threads composing the frames
+    * @param bar_size Size of the bars in the chart
+    * @param _view_bars Number of bars to display (0 to show all)
+    * @param _ticks Number of ticks to display (0 for none)
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    * @param _tween_frames Frames drawn from a bar chart to the next one
+    */
+   void drawInParallel(FrameBuffer& frame, FramePacer& pacer,
+     vector<shared_ptr<BarChart>> const& stored, unsigned threads,
+     short bar_size, short _view_bars, short _ticks, short _terminal_size,
+     short _tween_frames) const;
+
+   /**
+    * @brief Draw the frames that lead from a bar chart to the next one
+    * @param frame The buffer that composes and writes the frames
+    * @param pacer The scheduler of the frames
+    * @param tweener The builder of the frames in between
+    * @param previous The bar chart drawn before (null for the first one)
+    * @param bar_chart The bar chart to draw
+    * @param last true if it is the last bar chart
+    * @param bar_size Size of the bars in the chart
+    * @param _view_bars Number of bars to display (0 to show all)
+    * @param _ticks Number of ticks to display (0 for none)
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    * @param _tween_frames Frames drawn from the previous bar chart to this one
+    */
+   void drawKeyframe(FrameBuffer& frame, FramePacer& pacer,
+     FrameTweener& tweener, BarChart const* previous,
+     BarChart const& bar_chart, bool last, short bar_size, short _view_bars,
+     short _ticks, short _terminal_size, short _tween_frames) const;
+
+   /**
+    * @brief Wait for the deadline of the next frame and draw a bar chart,
+    * unless the frame is dropped
+    * @param frame The buffer that composes and writes the frame
+    * @param pacer The scheduler of the frames
+    * @param bar_chart The bar chart to draw
+    * @param last true if it is the last frame, which is never dropped
+    * @param bar_size Size of the bars in the chart
+    * @param _view_bars Number of bars to display (0 to show all)
+    * @param _ticks Number of ticks to display (0 for none)
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    */
+   void drawFrame(FrameBuffer& frame, FramePacer& pacer,
+     BarChart const& bar_chart, bool last, short bar_size, short _view_bars,
+     short _ticks, short _terminal_size) const;
 
-   vector<shared_ptr<BarChart>>
-     bar_charts; ///< Vector of shared pointers to BarChart objects
+   /**
+    * @brief Append the whole frame of a bar chart to a buffer
+    * @param frame The buffer that composes the frame
+    * @param bar_chart The bar chart to draw
+    * @param layout The parts of the frame that do not change, which keeps
+    * the line of the last time stamp drawn
+    * @param bar_size Size of the bars in the chart
+    * @param _view_bars Number of bars to display (0 to show all)
+    * @param _ticks Number of ticks to display (0 for none)
+    * @param _terminal_size Terminal size for proper formatting (0 for default)
+    */
+   void composeFrame(FrameBuffer& frame, BarChart const& bar_chart,
+     FrameLayout& layout, short bar_size, short _view_bars, short _ticks,
+     short _terminal_size) const;
 };
 
 #endif /// DATABASE_HPP_
\ No newline at end of file
@@ -0,0 +1,557 @@
+/**
+ * @file DatabaseCache.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the DatabaseCache class, which stores a parsed
+ * Database in a binary file next to the data file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "DatabaseCache.hpp"
+
+#include <cstring> /// memcmp, memcpy
+#include <filesystem> /// file_size, last_write_time, rename, remove
+#include <fstream> /// ofstream
+#include <unordered_map> /// unordered_map
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cstdlib> /// mkstemp
+#include <sys/stat.h> /// fchmod
+#include <unistd.h> /// close
+#define DATABASE_CACHE_MKSTEMP_SUPPORTED
+#endif
+
+namespace {
+   constexpr char CACHE_MAGIC[8] { 'B', 'R', 'C', 'A', 'C', 'H', 'E', '\0' };
+   constexpr size_t SECTION_ALIGNMENT { 16 }; ///< Alignment of each column
+
+   /**
+    * @brief Columns stored in the cache, in file order
+    */
+   enum CacheSection {
+      STRING_OFFSETS, ///< uint64_t offset of each string, plus the end
+      STRING_DATA, ///< Characters of every string
+      CATEGORY_NAMES, ///< uint32_t string id of each category
+      CATEGORY_COLORS, ///< int16_t color of each category
+      FRAME_TIME_STAMPS, ///< uint32_t string id of each time stamp
+      FRAME_FIRST_BARS, ///< uint64_t first bar of each frame, plus the end
+      FRAME_ORDERED, ///< uint64_t number of bars in order of each frame
+      BAR_LABELS, ///< uint32_t string id of each label
+      BAR_INFOS, ///< uint32_t string id of each other related info
+      BAR_CATEGORIES, ///< uint32_t string id of each category
+      BAR_VALUES, ///< long double value of each bar
+      BAR_PREVIOUS_RANKS, ///< uint32_t position of each bar in the last frame
+      WARNINGS, ///< uint32_t string id of each warning
+      SECTION_COUNT, ///< Number of columns
+   };
+
+   /**
+    * @brief Header at the start of a cache file
+    */
+   struct CacheHeader {
+      char magic[8]; ///< CACHE_MAGIC
+      uint32_t version; ///< CACHE_VERSION
+      uint32_t long_double_size; ///< sizeof(long double) of the writer
+      uint64_t input_size; ///< Size of the data file
+      int64_t input_time; ///< Modification time of the data file
+      int16_t select_columns[COLUMNS]; ///< Columns used by the parse
+      uint8_t colors; ///< Colors enabled during the parse
+      uint8_t value_warnings; ///< Value warnings enabled during the parse
+      int16_t view_bars; ///< Bars displayed, which were ranked by the parse
+      int16_t ticks; ///< Ticks displayed, which were ranked by the parse
+      int64_t max_number_of_bars; ///< Maximum number of bars
+      uint64_t strings; ///< Number of strings in the dictionary
+      uint64_t categories; ///< Number of categories
+      uint64_t frames; ///< Number of bar charts
+      uint64_t bars; ///< Number of bars
+      uint64_t warnings; ///< Number of warnings
+      uint32_t title; ///< String id of the title
+      uint32_t scale; ///< String id of the scale
+      uint32_t source; ///< String id of the source
+      uint32_t reserved; ///< Unused
+      uint64_t offsets[SECTION_COUNT]; ///< Offset of each column
+      uint64_t sizes[SECTION_COUNT]; ///< Size in bytes of each column
+   };
+
+   /**
+    * @brief Dictionary that gives an id to each distinct string
+    */
+   class StringTable {
+      public:
+      /**
+       * @brief Get the id of a string, adding it if needed
+       * @param text The string
+       * @return Id of the string
+       */
+      uint32_t add(string const& text) {
+         auto found { ids.find(text) };
+
+         if (found != ids.end()) {
+            return found->second;
+         }
+
+         uint32_t const id { static_cast<uint32_t>(offsets.size() - 1) };
+         ids.emplace(text, id);
+         data += text;
+         offsets.push_back(data.size());
+
+         return id;
+      }
+
+      /**
+       * @brief Get the id of an interned string, adding it if needed
+       * @param pooled StringPool id of the string
+       * @return Id of the string
+       */
+      uint32_t add(uint32_t pooled) {
+         if (pooled >= pooled_ids.size()) {
+            pooled_ids.resize(pooled + 1, NO_ID);
+         }
+
+         if (pooled_ids[pooled] == NO_ID) {
+            pooled_ids[pooled] = add(
+              string(StringPool::getInstance().resolve(pooled)));
+         }
+
+         return pooled_ids[pooled];
+      }
+
+      static constexpr uint32_t NO_ID { UINT32_MAX }; ///< Id not added yet
+
+      std::unordered_map<string, uint32_t> ids; ///< Id of each string
+      vector<uint32_t> pooled_ids; ///< Id of each StringPool id
+      vector<uint64_t> offsets { 0 }; ///< Offsets, plus the end
+      string data; ///< Characters of every string
+   };
+
+   // Check if a column fits in the file and has the expected size
+   bool isValidSection(CacheHeader const& header, CacheSection section,
+     uint64_t expected_size, uint64_t file_size) {
+      return header.sizes[section] == expected_size
+        && header.offsets[section] % SECTION_ALIGNMENT == 0
+        && header.offsets[section] <= file_size
+        && expected_size <= file_size - header.offsets[section];
+   }
+
+   // Get a typed pointer to a column of a mapped cache
+   template <typename T>
+   T const* getSection(
+     string_view file, CacheHeader const& header, CacheSection section) {
+      return reinterpret_cast<T const*>(file.data() + header.offsets[section]);
+   }
+}
+
+// Constructor for the DatabaseCache class
+DatabaseCache::DatabaseCache(ProgramConfig const& program_config_)
+    : program_config(program_config_) {
+   std::error_code error;
+   std::filesystem::path const path { program_config.data_file };
+
+   if (!std::filesystem::is_regular_file(path, error)) {
+      return;
+   }
+
+   input_size = std::filesystem::file_size(path, error);
+   input_time = std::filesystem::last_write_time(path, error)
+                  .time_since_epoch()
+                  .count();
+   available = !error;
+}
+
+// Check if the data file can have a cache
+bool DatabaseCache::isAvailable() const {
+   return available;
+}
+
+// Get the location of the cache file
+string DatabaseCache::getCacheFile() const {
+   return program_config.data_file + CACHE_EXTENSION;
+}
+
+// Get the size of the cache file read by the last load
+size_t DatabaseCache::getBytesRead() const {
+   return bytes_read;
+}
+
+// Restore a Database from a valid cache
+bool DatabaseCache::load(
+  Database& database, vector<string>& warnings, short& max_number_of_bars) {
+   if (!available) {
+      return false;
+   }
+
+   MappedFile mapped_file;
+
+   try {
+      mapped_file.open(getCacheFile());
+   } catch (std::runtime_error&) { return false; }
+
+   string_view const file { mapped_file.getView() };
+   CacheHeader header;
+
+   if (file.size() < sizeof(header)) {
+      return false;
+   }
+
+   std::memcpy(&header, file.data(), sizeof(header));
+
+   // The cache must match the writer, the data file and the configuration
+   bool valid { std::memcmp(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC))
+       == 0
+     && header.version == CACHE_VERSION
+     && header.long_double_size == sizeof(long double)
+     && header.input_size == input_size && header.input_time == input_time
+     && header.colors == program_config.colors
+     && header.value_warnings == program_config.value_warnings
+     && header.view_bars == program_config.number_of_bars
+     && header.ticks == program_config.ticks };
+
+   for (short index { 0 }; valid && index < COLUMNS; ++index) {
+      valid = header.select_columns[index]
+        == program_config.select_columns[index];
+   }
+
+   // Every column must fit in the file before anything is read
+   uint64_t const size { file.size() };
+   valid = valid && header.strings < UINT32_MAX && header.bars < size
+     && header.frames < size && header.categories < size
+     && header.warnings < size
+     && isValidSection(header,
+       STRING_OFFSETS,
+       (header.strings + 1) * sizeof(uint64_t),
+       size);
+
+   if (!valid) {
+      return false;
+   }
+
+   uint64_t const* string_offsets { getSection<uint64_t>(
+     file, header, STRING_OFFSETS) };
+
+   valid = isValidSection(
+             header, STRING_DATA, string_offsets[header.strings], size)
+     && isValidSection(header,
+       CATEGORY_NAMES,
+       header.categories * sizeof(uint32_t),
+       size)
+     && isValidSection(header,
+       CATEGORY_COLORS,
+       header.categories * sizeof(int16_t),
+       size)
+     && isValidSection(header,
+       FRAME_TIME_STAMPS,
+       header.frames * sizeof(uint32_t),
+       size)
+     && isValidSection(header,
+       FRAME_FIRST_BARS,
+       (header.frames + 1) * sizeof(uint64_t),
+       size)
+     && isValidSection(
+       header, FRAME_ORDERED, header.frames * sizeof(uint64_t), size)
+     && isValidSection(
+       header, BAR_LABELS, header.bars * sizeof(uint32_t), size)
+     && isValidSection(header, BAR_INFOS, header.bars * sizeof(uint32_t), size)
+     && isValidSection(
+       header, BAR_CATEGORIES, header.bars * sizeof(uint32_t), size)
+     && isValidSection(
+       header, BAR_VALUES, header.bars * sizeof(long double), size)
+     && isValidSection(
+       header, BAR_PREVIOUS_RANKS, header.bars * sizeof(uint32_t), size)
+     && isValidSection(
+       header, WARNINGS, header.warnings * sizeof(uint32_t), size);
+
+   if (!valid) {
+      return false;
+   }
+
+   char const* string_data { getSection<char>(file, header, STRING_DATA) };
+   uint32_t const* category_names { getSection<uint32_t>(
+     file, header, CATEGORY_NAMES) };
+   int16_t const* category_colors { getSection<int16_t>(
+     file, header, CATEGORY_COLORS) };
+   uint32_t const* time_stamps { getSection<uint32_t>(
+     file, header, FRAME_TIME_STAMPS) };
+   uint64_t const* first_bars { getSection<uint64_t>(
+     file, header, FRAME_FIRST_BARS) };
+   uint64_t const* ordered { getSection<uint64_t>(
+     file, header, FRAME_ORDERED) };
+   uint32_t const* labels { getSection<uint32_t>(file, header, BAR_LABELS) };
+   uint32_t const* infos { getSection<uint32_t>(file, header, BAR_INFOS) };
+   uint32_t const* bar_categories { getSection<uint32_t>(
+     file, header, BAR_CATEGORIES) };
+   long double const* values { getSection<long double>(
+     file, header, BAR_VALUES) };
+   uint32_t const* previous_ranks { getSection<uint32_t>(
+     file, header, BAR_PREVIOUS_RANKS) };
+   uint32_t const* warning_ids { getSection<uint32_t>(
+     file, header, WARNINGS) };
+
+   // Check the dictionary and every reference to it
+   for (uint64_t index { 0 }; valid && index < header.strings; ++index) {
+      valid = string_offsets[index] <= string_offsets[index + 1];
+   }
+
+   for (uint64_t index { 0 }; valid && index < header.frames; ++index) {
+      valid = first_bars[index] <= first_bars[index + 1]
+        && ordered[index] <= first_bars[index + 1] - first_bars[index]
+        && time_stamps[index] < header.strings;
+   }
+
+   valid = valid && first_bars[0] == 0
+     && first_bars[header.frames] == header.bars
+     && header.title < header.strings && header.scale < header.strings
+     && header.source < header.strings;
+
+   for (uint64_t index { 0 }; valid && index < header.categories; ++index) {
+      valid = category_names[index] < header.strings;
+   }
+
+   for (uint64_t index { 0 }; valid && index < header.warnings; ++index) {
+      valid = warning_ids[index] < header.strings;
+   }
+
+   if (!valid) {
+      return false;
+   }
+
+   auto text { [&](uint32_t id) -> string {
+      return string(string_data + string_offsets[id],
+        string_offsets[id + 1] - string_offsets[id]);
+   } };
+
+   // Intern each string once, on its first use by a bar or a category
+   StringPool& pool { StringPool::getInstance() };
+   vector<uint32_t> pooled_ids(header.strings, StringTable::NO_ID);
+
+   auto pooled { [&](uint32_t id) -> uint32_t {
+      if (pooled_ids[id] == StringTable::NO_ID) {
+         pooled_ids[id] = pool.intern(string_view(string_data
+             + string_offsets[id],
+           string_offsets[id + 1] - string_offsets[id]));
+      }
+
+      return pooled_ids[id];
+   } };
+
+   // Every bar goes to columns of its own: the values and ranks are copied
+   // in bulk and the string ids are remapped to the pool in a single pass
+   shared_ptr<BarColumns> columns { make_shared<BarColumns>() };
+   columns->values.assign(values, values + header.bars);
+   columns->previous_ranks.assign(previous_ranks, previous_ranks + header.bars);
+
+   auto const remap { [&](vector<uint32_t>& column, uint32_t const* ids) {
+      column.resize(header.bars);
+
+      for (uint64_t index { 0 }; valid && index < header.bars; ++index) {
+         valid = ids[index] < header.strings;
+         column[index] = valid ? pooled(ids[index]) : 0;
+      }
+   } };
+
+   remap(columns->labels, labels);
+   remap(columns->infos, infos);
+   remap(columns->categories, bar_categories);
+
+   if (!valid) {
+      return false;
+   }
+
+   database.setTitle(text(header.title));
+   database.setScale(text(header.scale));
+   database.setSource(text(header.source));
+
+   for (uint64_t index { 0 }; index < header.categories; ++index) {
+      database.addCategory(
+        pooled(category_names[index]), category_colors[index]);
+   }
+
+   // The bars are stored ranked, so each bar chart is a view of the columns
+   for (uint64_t frame { 0 }; frame < header.frames; ++frame) {
+      database.adoptBarChart(make_shared<BarChart>(text(time_stamps[frame]),
+        columns,
+        first_bars[frame],
+        first_bars[frame + 1] - first_bars[frame],
+        ordered[frame]));
+   }
+
+   for (uint64_t index { 0 }; index < header.warnings; ++index) {
+      warnings.push_back(text(warning_ids[index]));
+   }
+
+   max_number_of_bars = static_cast<short>(header.max_number_of_bars);
+   bytes_read = file.size();
+
+   return true;
+}
+
+// Write the cache of a parsed Database
+bool DatabaseCache::save(Database const& database,
+  vector<string> const& warnings, short max_number_of_bars) const {
+   if (!available || !database.isComplete()) {
+      return false;
+   }
+
+   CacheHeader header {};
+   std::memcpy(header.magic, CACHE_MAGIC, sizeof(CACHE_MAGIC));
+   header.version = CACHE_VERSION;
+   header.long_double_size = sizeof(long double);
+   header.input_size = input_size;
+   header.input_time = input_time;
+   header.colors = program_config.colors;
+   header.value_warnings = program_config.value_warnings;
+   header.view_bars = program_config.number_of_bars;
+   header.ticks = program_config.ticks;
+   header.max_number_of_bars = max_number_of_bars;
+
+   for (short index { 0 }; index < COLUMNS; ++index) {
+      header.select_columns[index] = program_config.select_columns[index];
+   }
+
+   StringTable strings;
+   header.title = strings.add(database.getTitle());
+   header.scale = strings.add(database.getScale());
+   header.source = strings.add(database.getSource());
+
+   vector<uint32_t> category_names;
+   vector<int16_t> category_colors;
+
+   vector<short> const colors { database.getCategoryColors() };
+
+   for (uint32_t category : database.getCategories()) {
+      category_names.push_back(strings.add(category));
+      category_colors.push_back(colors[category]);
+   }
+
+   vector<uint32_t> time_stamps;
+   vector<uint64_t> first_bars { 0 };
+   vector<uint64_t> ordered;
+   vector<uint32_t> labels;
+   vector<uint32_t> infos;
+   vector<uint32_t> bar_categories;
+   vector<long double> values;
+   vector<uint32_t> previous_ranks;
+
+   for (shared_ptr<BarChart> const& bar_chart : database.getBarCharts()) {
+      time_stamps.push_back(strings.add(bar_chart->getTimeStamp()));
+      ordered.push_back(bar_chart->getNumberOfOrderedBars());
+
+      for (size_t index { 0 }; index < bar_chart->getNumberOfBars(); ++index) {
+         labels.push_back(strings.add(bar_chart->getLabels()[index]));
+         infos.push_back(strings.add(bar_chart->getInfos()[index]));
+         bar_categories.push_back(
+           strings.add(bar_chart->getCategories()[index]));
+         values.push_back(bar_chart->getValues()[index]);
+         previous_ranks.push_back(bar_chart->getPreviousRanks()[index]);
+      }
+
+      first_bars.push_back(labels.size());
+   }
+
+   vector<uint32_t> warning_ids;
+
+   for (string const& warning : warnings) {
+      warning_ids.push_back(strings.add(warning));
+   }
+
+   header.strings = strings.offsets.size() - 1;
+   header.categories = category_names.size();
+   header.frames = time_stamps.size();
+   header.bars = labels.size();
+   header.warnings = warning_ids.size();
+
+   // Lay out the columns one after the other, each one aligned
+   void const* sections[SECTION_COUNT] { strings.offsets.data(),
+      strings.data.data(),
+      category_names.data(),
+      category_colors.data(),
+      time_stamps.data(),
+      first_bars.data(),
+      ordered.data(),
+      labels.data(),
+      infos.data(),
+      bar_categories.data(),
+      values.data(),
+      previous_ranks.data(),
+      warning_ids.data() };
+
+   header.sizes[STRING_OFFSETS] = strings.offsets.size() * sizeof(uint64_t);
+   header.sizes[STRING_DATA] = strings.data.size();
+   header.sizes[CATEGORY_NAMES] = category_names.size() * sizeof(uint32_t);
+   header.sizes[CATEGORY_COLORS] = category_colors.size() * sizeof(int16_t);
+   header.sizes[FRAME_TIME_STAMPS] = time_stamps.size() * sizeof(uint32_t);
+   header.sizes[FRAME_FIRST_BARS] = first_bars.size() * sizeof(uint64_t);
+   header.sizes[FRAME_ORDERED] = ordered.size() * sizeof(uint64_t);
+   header.sizes[BAR_LABELS] = labels.size() * sizeof(uint32_t);
+   header.sizes[BAR_INFOS] = infos.size() * sizeof(uint32_t);
+   header.sizes[BAR_CATEGORIES] = bar_categories.size() * sizeof(uint32_t);
+   header.sizes[BAR_VALUES] = values.size() * sizeof(long double);
+   header.sizes[BAR_PREVIOUS_RANKS] = previous_ranks.size() * sizeof(uint32_t);
+   header.sizes[WARNINGS] = warning_ids.size() * sizeof(uint32_t);
+
+   uint64_t offset { sizeof(header) };
+
+   for (short section { 0 }; section < SECTION_COUNT; ++section) {
+      offset = (offset + SECTION_ALIGNMENT - 1) / SECTION_ALIGNMENT
+        * SECTION_ALIGNMENT;
+      header.offsets[section] = offset;
+      offset += header.sizes[section];
+   }
+
+   string const cache_file { getCacheFile() };
+   string temporary_file { cache_file + ".tmp" };
+
+#ifdef DATABASE_CACHE_MKSTEMP_SUPPORTED
+   // Concurrent runs each write a file of their own before the rename
+   string unique_file { cache_file + ".XXXXXX" };
+   int const descriptor { ::mkstemp(unique_file.data()) };
+
+   if (descriptor < 0) {
+      return false;
+   }
+
+   ::fchmod(descriptor, 0644);
+   ::close(descriptor);
+   temporary_file = unique_file;
+#endif
+
+   {
+      std::ofstream file { temporary_file, std::ios::binary | std::ios::trunc };
+
+      if (!file.is_open()) {
+         return false;
+      }
+
+      char const padding[SECTION_ALIGNMENT] {};
+      uint64_t written { sizeof(header) };
+      file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+      for (short section { 0 }; section < SECTION_COUNT; ++section) {
+         file.write(padding, header.offsets[section] - written);
+         file.write(static_cast<char const*>(sections[section]),
+           header.sizes[section]);
+         written = header.offsets[section] + header.sizes[section];
+      }
+
+      // The last buffer is only written, and may only fail, on close
+      file.close();
+
+      if (file.fail()) {
+         std::error_code error;
+         std::filesystem::remove(temporary_file, error);
+         return false;
+      }
+   }
+
+   std::error_code error;
+   std::filesystem::rename(temporary_file, cache_file, error);
+
+   if (error) {
+      std::filesystem::remove(temporary_file, error);
+      return false;
+   }
+
+   return true;
+}
@@ -0,0 +1,104 @@
+/**
+ * @file DatabaseCache.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Defines the DatabaseCache class, which stores a parsed Database in a
+ * binary file next to the data file.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The cache is a versioned columnar file: a header, a dictionary of strings
+ * and one column per attribute of the categories, bar charts and bars. The
+ * bars are stored ranked, with the rank each one had in the previous bar
+ * chart. The file is memory-mapped when read and its columns are copied in
+ * bulk, so a Database is rebuilt without parsing any text or ranking any bar.
+ * A cache is only used when it was written for the same size and modification
+ * time of the data file, and for the same column, color, bars and ticks
+ * configuration.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef DATABASE_CACHE_HPP_
+#define DATABASE_CACHE_HPP_
+
+#include "Database.hpp"
+#include "mappedfile.hpp"
+#include "utils.hpp"
+
+#include <string> /// string
+using std::string;
+
+#include <vector> /// vector
+using std::vector;
+
+#include <cstdint> /// uint32_t, uint64_t
+
+constexpr char const* CACHE_EXTENSION { ".brcache" }; ///< Cache file suffix
+constexpr uint32_t CACHE_VERSION { 2 }; ///< Version of the cache format
+
+/**
+ * @brief DatabaseCache class that saves and restores a parsed Database
+ */
+class DatabaseCache {
+   public:
+   /**
+    * @brief Constructor for the DatabaseCache class
+    * @param program_config_ Program configuration with the data file and the
+    * settings that change the parsed data
+    */
+   DatabaseCache(ProgramConfig const& program_config_);
+
+   /**
+    * @brief Check if the data file can have a cache
+    * @return true if the data file is a regular file, false otherwise
+    */
+   bool isAvailable() const;
+
+   /**
+    * @brief Get the location of the cache file
+    * @return Path of the cache file
+    */
+   string getCacheFile() const;
+
+   /**
+    * @brief Get the size of the cache file read by the last load
+    * @return Size in bytes
+    */
+   size_t getBytesRead() const;
+
+   /**
+    * @brief Restore a Database from a valid cache
+    * @param database The Database that receives the data
+    * @param warnings The list that receives the warnings of the parse
+    * @param max_number_of_bars Receives the maximum number of bars
+    * @return true if the cache was valid and read, false otherwise
+    */
+   bool load(Database& database, vector<string>& warnings,
+     short& max_number_of_bars);
+
+   /**
+    * @brief Write the cache of a parsed Database
+    *
+    * The cache is written to a temporary file of its own and renamed, so a
+    * reader never sees a partial cache, even with concurrent writers. Nothing
+    * is written if the Database dropped bar charts from its history. Failures
+    * are ignored, since the cache is optional.
+    *
+    * @param database The parsed Database
+    * @param warnings The warnings raised by the parse
+    * @param max_number_of_bars The maximum number of bars
+    * @return true if the cache was written, false otherwise
+    */
+   bool save(Database const& database, vector<string> const& warnings,
+     short max_number_of_bars) const;
+
+   private:
+   ProgramConfig const& program_config; ///< Program configuration
+   bool available { false }; ///< The data file is a regular file
+   uint64_t input_size { 0 }; ///< Size of the data file
+   int64_t input_time { 0 }; ///< Modification time of the data file
+   size_t bytes_read { 0 }; ///< Size of the cache read by the last load
+};
+
+#endif /// DATABASE_CACHE_HPP_
@@ -0,0 +1,170 @@
+/**
+ * @file FrameRanker.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the FrameRanker class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "FrameRanker.hpp"
+
+#include "profiler.hpp" /// PROFILE_SCOPE
+
+#include <numeric> /// iota
+
+namespace {
+   constexpr size_t NO_BAR { SIZE_MAX }; ///< Empty slot of the seed order
+   constexpr size_t MOVES_PER_BAR {
+      8
+   }; ///< Average moves allowed before sorting from scratch
+}
+
+// Put the bars drawn of the next bar chart in order
+void FrameRanker::rank(BarChart& bar_chart) {
+   PROFILE_SCOPE(PHASE_SORT);
+
+   size_t const length { bar_chart.getNumberOfBars() };
+   size_t const count { getCount(length) };
+   long double const* values { bar_chart.getValues() };
+   uint32_t const* labels { bar_chart.getLabels() };
+
+   auto const lastRank { [this](uint32_t label) -> uint32_t {
+      return label < label_ranks.size() ? label_ranks[label] : NO_RANK;
+   } };
+
+   LargerBar const larger { values };
+
+   // Seed the order with the bars ranked in the last bar chart
+   slots.assign(last_ordered, NO_BAR);
+   previous_ranks.resize(length);
+
+   for (size_t index { 0 }; index != length; ++index) {
+      uint32_t const rank { lastRank(labels[index]) };
+      previous_ranks[index] = rank;
+
+      if (rank < last_ordered && slots[rank] == NO_BAR) {
+         slots[rank] = index;
+      }
+   }
+
+   top.clear();
+   ranked.assign(length, false);
+
+   for (size_t slot : slots) {
+      if (slot != NO_BAR) {
+         top.push_back(slot);
+         ranked[slot] = true;
+      }
+   }
+
+   if (count == length) {
+      // Every bar is ranked, the new ones from the end
+      for (size_t index { 0 }; index != length; ++index) {
+         if (!ranked[index]) {
+            top.push_back(index);
+            ranked[index] = true;
+         }
+      }
+   }
+
+   // Insertion sort, until it moves too much for a nearly sorted input
+   size_t moves { 0 };
+   size_t const budget { MOVES_PER_BAR * std::max(length, size_t { 1 }) };
+   bool exceeded { false };
+
+   auto const insert { [&](size_t position) {
+      size_t const bar { top[position] };
+      size_t target { position };
+
+      while (target != 0 && larger(bar, top[target - 1])) {
+         top[target] = top[target - 1];
+         --target;
+
+         if (++moves > budget) {
+            exceeded = true;
+            break;
+         }
+      }
+
+      top[target] = bar;
+   } };
+
+   for (size_t position { 1 }; position < top.size() && !exceeded;
+        ++position) {
+      insert(position);
+   }
+
+   if (exceeded) {
+      std::sort(top.begin(), top.end(), larger);
+   }
+
+   // Seeds that left the bars drawn go back to the other ones
+   while (top.size() > count) {
+      ranked[top.back()] = false;
+      top.pop_back();
+   }
+
+   // Bars of the rest of the bar chart that overtook the last one ranked
+   exceeded = false;
+
+   for (size_t index { 0 }; index != length && !exceeded; ++index) {
+      if (ranked[index]
+        || (top.size() == count && !larger(index, top.back()))) {
+         continue;
+      }
+
+      if (top.size() == count) {
+         ranked[top.back()] = false;
+         top.back() = index;
+      } else {
+         top.push_back(index);
+      }
+
+      ranked[index] = true;
+      insert(top.size() - 1);
+   }
+
+   if (exceeded) {
+      // Too many bars moved, select the largest ones from scratch
+      top.resize(length);
+      std::iota(top.begin(), top.end(), 0);
+      std::partial_sort(top.begin(), top.begin() + count, top.end(), larger);
+      top.resize(count);
+   }
+
+   bar_chart.arrangeTop(top, previous_ranks);
+
+   // Remember the ranks of this bar chart for the next one
+   for (uint32_t label : last_labels) {
+      label_ranks[label] = NO_RANK;
+   }
+
+   last_labels.assign(bar_chart.getLabels(), bar_chart.getLabels() + length);
+   last_ordered = count;
+
+   for (size_t position { 0 }; position != length; ++position) {
+      uint32_t const label { last_labels[position] };
+
+      if (label >= label_ranks.size()) {
+         label_ranks.resize(label + 1, NO_RANK);
+      }
+
+      if (label_ranks[label] == NO_RANK) {
+         // A repeated label keeps the rank of its first bar
+         label_ranks[label] = static_cast<uint32_t>(position);
+      }
+   }
+}
+
+// Get the number of bars of a bar chart that are drawn or used by its axis
+size_t FrameRanker::getCount(size_t length) const {
+   if (view_bars <= 0) {
+      return length;
+   }
+
+   return std::min(length,
+     static_cast<size_t>(std::max(view_bars, std::max<short>(ticks, 0))));
+}
@@ -0,0 +1,75 @@
+/**
+ * @file FrameRanker.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Defines the FrameRanker class, which sorts consecutive bar charts
+ * starting from the order of the previous one.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Consecutive bar charts of a race are ranked almost the same way. The
+ * FrameRanker remembers the rank of each label in the last bar chart, lays
+ * the largest bars of the next one out in that order and fixes it with an
+ * insertion sort, which is close to linear on nearly sorted input. Only the
+ * bars that are drawn are ranked; the other ones keep the order in which
+ * they were added and find their previous rank by label.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FRAME_RANKER_HPP_
+#define FRAME_RANKER_HPP_
+
+#include "BarChart.hpp"
+
+#include <vector> /// vector
+using std::vector;
+
+#include <cstdint> /// uint32_t
+
+#include <algorithm> /// sort
+
+/**
+ * @brief FrameRanker class that orders a sequence of bar charts
+ */
+class FrameRanker {
+   public:
+   /**
+    * @brief Constructor for the FrameRanker class
+    * @param _view_bars Number of bars displayed (0 for all)
+    * @param _ticks Number of ticks displayed (0 for none)
+    */
+   FrameRanker(short _view_bars = 0, short _ticks = 0)
+       : view_bars(_view_bars), ticks(_ticks) { }
+
+   /**
+    * @brief Put the bars drawn of the next bar chart in order and record the
+    * rank each bar had in the previous one
+    * @param bar_chart The next bar chart of the sequence
+    */
+   void rank(BarChart& bar_chart);
+
+   private:
+   short view_bars; ///< Number of bars displayed (0 for all)
+   short ticks; ///< Number of ticks displayed
+
+   vector<uint32_t>
+     label_ranks; ///< Rank of each StringPool label id in the last bar chart
+   vector<uint32_t> last_labels; ///< Labels of the last bar chart, in order
+   size_t last_ordered { 0 }; ///< Bars of the last bar chart in order
+
+   vector<size_t> slots; ///< Bar at each rank of the order of the last one
+   vector<size_t> top; ///< Bars ranked, from the largest value
+   vector<bool> ranked; ///< Whether each bar is in top
+   vector<uint32_t> previous_ranks; ///< Previous rank of each bar
+
+   /**
+    * @brief Get the number of bars of a bar chart that are drawn or used by
+    * its axis
+    * @param length Number of bars of the bar chart
+    * @return Number of bars to rank
+    */
+   size_t getCount(size_t length) const;
+};
+
+#endif /// FRAME_RANKER_HPP_
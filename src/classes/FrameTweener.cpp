@@ -0,0 +1,155 @@
+/**
+ * @file FrameTweener.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the FrameTweener class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "FrameTweener.hpp"
+
+// Set the bar charts to interpolate between
+void FrameTweener::setKeyframes(
+  BarChart const& from, BarChart const& to, short _view_bars, short _ticks) {
+   // Each frame has the bars the next bar chart would draw or use for its axis
+   size_t const view_bars { _view_bars == 0
+       ? to.getNumberOfBars()
+       : static_cast<size_t>(_view_bars) };
+   count = std::min(to.getNumberOfBars(),
+     std::max(view_bars, static_cast<size_t>(std::max<short>(_ticks, 0))));
+   size_t const from_count { std::min(from.getNumberOfBars(), count) };
+
+   if (from.getNumberOfOrderedBars() < from_count
+     || to.getNumberOfOrderedBars() < count) {
+      // Bar charts are ranked when they are loaded, so this is not expected
+      BarChart ordered_from { from };
+      BarChart ordered_to { to };
+      ordered_from.order(from_count);
+      ordered_to.order(count);
+      setKeyframes(ordered_from, ordered_to, _view_bars, _ticks);
+      return;
+   }
+
+   from_time_stamp = from.getTimeStamp();
+   to_time_stamp = to.getTimeStamp();
+
+   long double const* from_values { from.getValues() };
+   uint32_t const* from_labels { from.getLabels() };
+   long double const* to_values { to.getValues() };
+   uint32_t const* to_labels { to.getLabels() };
+   uint32_t const* to_infos { to.getInfos() };
+   uint32_t const* to_categories { to.getCategories() };
+   uint32_t const* previous_ranks { to.getPreviousRanks() };
+
+   // A rank is only trusted if it points to the same label, as the first bar
+   // chart may not be the one ranked before the next (bar charts dropped by
+   // the stream queue)
+   auto const matches { [&](size_t index) -> bool {
+      uint32_t const rank { previous_ranks[index] };
+      return rank < from.getNumberOfBars()
+        && from_labels[rank] == to_labels[index];
+   } };
+
+   // Find where the largest bars of the first bar chart went
+   next_ranks.assign(from_count, NO_RANK);
+
+   for (size_t index { 0 }; index != to.getNumberOfBars(); ++index) {
+      if (previous_ranks[index] < from_count && matches(index)) {
+         next_ranks[previous_ranks[index]] = static_cast<uint32_t>(index);
+      }
+   }
+
+   tracks.clear();
+
+   // The largest bars of the next bar chart, which grow from 0 if new
+   for (size_t index { 0 }; index != count; ++index) {
+      tracks.push_back({ matches(index) ? from_values[previous_ranks[index]]
+                                        : 0,
+        to_values[index],
+        static_cast<uint32_t>(index),
+        to_labels[index],
+        to_infos[index],
+        to_categories[index] });
+   }
+
+   // The largest bars of the first bar chart that leave the view, which
+   // shrink to 0 if they are gone
+   uint32_t const* from_infos { from.getInfos() };
+   uint32_t const* from_categories { from.getCategories() };
+
+   for (size_t rank { 0 }; rank != from_count; ++rank) {
+      uint32_t const next_rank { next_ranks[rank] };
+
+      if (next_rank != NO_RANK && next_rank < count) {
+         continue;
+      }
+
+      tracks.push_back({ from_values[rank],
+        next_rank != NO_RANK ? to_values[next_rank] : 0,
+        next_rank,
+        from_labels[rank],
+        from_infos[rank],
+        from_categories[rank] });
+   }
+}
+
+// Build a frame in between the keyframes
+BarChart const& FrameTweener::at(double progress) {
+   values.resize(tracks.size());
+   order.resize(tracks.size());
+
+   for (size_t index { 0 }; index != tracks.size(); ++index) {
+      Track const& track { tracks[index] };
+      values[index] = progress >= 1
+        ? track.to
+        : track.from + (track.to - track.from) * progress;
+      order[index] = index;
+   }
+
+   // Values that are not numbers come last, as with LargerBar, and ties keep
+   // the order of the next bar chart, so the last frame shows it
+   std::sort(order.begin(), order.end(), [this](size_t lhs, size_t rhs) {
+      bool const lhs_number { !std::isnan(values[lhs]) };
+      bool const rhs_number { !std::isnan(values[rhs]) };
+
+      if (lhs_number != rhs_number) {
+         return lhs_number;
+      }
+
+      if (lhs_number && values[lhs] != values[rhs]) {
+         return values[lhs] > values[rhs];
+      }
+
+      return tracks[lhs].rank < tracks[rhs].rank
+        || (tracks[lhs].rank == tracks[rhs].rank && lhs < rhs);
+   });
+
+   size_t const length { std::min(count, tracks.size()) };
+
+   columns->values.clear();
+   columns->labels.clear();
+   columns->infos.clear();
+   columns->categories.clear();
+   columns->previous_ranks.clear();
+
+   for (size_t position { 0 }; position != length; ++position) {
+      Track const& track { tracks[order[position]] };
+      columns->values.push_back(values[order[position]]);
+      columns->labels.push_back(track.label);
+      columns->infos.push_back(track.info);
+      columns->categories.push_back(track.category);
+      columns->previous_ranks.push_back(NO_RANK);
+   }
+
+   // The time stamp changes halfway
+   frame = BarChart { progress < 0.5 ? from_time_stamp : to_time_stamp,
+      columns,
+      0,
+      length,
+      length };
+
+   return frame;
+}
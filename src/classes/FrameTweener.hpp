@@ -0,0 +1,97 @@
+/**
+ * @file FrameTweener.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Defines the FrameTweener class, which builds the frames in between
+ * two consecutive bar charts.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The bar charts of the data are keyframes. Between two of them, the value of
+ * each label moves linearly from the first to the second and the bars are
+ * ranked by the values reached, so they slide past each other instead of
+ * jumping to their new rows.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FRAME_TWEENER_HPP_
+#define FRAME_TWEENER_HPP_
+
+#include "BarChart.hpp"
+
+#include <vector> /// vector
+using std::vector;
+
+#include <string> /// string
+using std::string;
+
+#include <memory> /// shared_ptr, make_shared
+using std::make_shared;
+using std::shared_ptr;
+
+#include <cstdint> /// uint32_t
+
+#include <algorithm> /// sort, min, max
+
+/**
+ * @brief FrameTweener class that interpolates between two bar charts
+ *
+ * Only the bars that can be drawn are followed: the largest ones of both bar
+ * charts, matched by the rank each bar had in the previous bar chart. Setting
+ * the keyframes reads that rank once for every bar, and each frame in between
+ * costs a sort of the bars followed.
+ */
+class FrameTweener {
+   public:
+   /**
+    * @brief Default constructor for the FrameTweener class
+    */
+   FrameTweener() : columns(make_shared<BarColumns>()) { }
+
+   /**
+    * @brief Set the bar charts to interpolate between
+    * @param from The first bar chart, drawn before the frames in between
+    * @param to The next bar chart, ranked right after the first one
+    * @param _view_bars Number of bars displayed (0 for all)
+    * @param _ticks Number of ticks displayed (0 for none)
+    */
+   void setKeyframes(BarChart const& from, BarChart const& to,
+     short _view_bars = 0, short _ticks = 0);
+
+   /**
+    * @brief Build a frame in between the keyframes
+    * @param progress Fraction of the way from the first bar chart to the
+    * next one, in (0, 1]; at 1 the frame shows the next bar chart
+    * @return The frame, valid until the next call
+    */
+   BarChart const& at(double progress);
+
+   private:
+   /**
+    * @brief Bar followed from one keyframe to the next
+    */
+   struct Track {
+      long double from; ///< Value in the first bar chart (0 if absent)
+      long double to; ///< Value in the next bar chart (0 if absent)
+      uint32_t rank; ///< Rank in the next bar chart (NO_RANK if absent)
+      uint32_t label; ///< StringPool id of the label
+      uint32_t info; ///< StringPool id of the other related info
+      uint32_t category; ///< StringPool id of the category
+   };
+
+   vector<Track> tracks; ///< Bars followed between the keyframes
+   vector<uint32_t> next_ranks; ///< Rank in the next bar chart of each of the
+                                ///< largest bars of the first one
+   vector<size_t> order; ///< Tracks in the order of the frame being built
+   vector<long double> values; ///< Values of the tracks in the frame
+
+   size_t count { 0 }; ///< Number of bars of each frame
+   string from_time_stamp; ///< Time stamp of the first bar chart
+   string to_time_stamp; ///< Time stamp of the next bar chart
+
+   shared_ptr<BarColumns> columns; ///< Bars of the frame being built
+   BarChart frame; ///< Frame being built
+};
+
+#endif /// FRAME_TWEENER_HPP_
@@ -31,7 +31,12 @@ GameController& GameController::getInstance() {
    return *instance;
 }
 
-// Destructor for GameController, destroys the singleton instance
+// Destructor for GameController, stops the parser thread if it is running
+GameController::~GameController() {
+   finishStreaming();
+}
+
+// Destroys the singleton instance
 void GameController::destruct() {
    delete instance;
    instance = nullptr;
@@ -47,6 +52,26 @@ void GameController::initialize(int arguments_count, char* arguments[]) {
    program_config = cli.getProgramConfigs();
    cli.destruct();
 
+   if (program_config.stats) {
+#ifdef BAR_RACE_PROFILING
+      Profiler::getInstance().enable();
+#else
+      program_config.warnings.push_back(
+        "The profiler was not built (BAR_RACE_PROFILING), \"--stats\" is "
+        "ignored.");
+#endif
+   }
+
+   if (!program_config.trace_file.empty()) {
+#ifdef BAR_RACE_PROFILING
+      Tracer::getInstance().enable();
+#else
+      program_config.warnings.push_back(
+        "The tracer was not built (BAR_RACE_PROFILING), \"--trace\" is "
+        "ignored.");
+#endif
+   }
+
    // Set the initial game state to STARTING
    game_state = STARTING;
 }
@@ -67,7 +92,10 @@ void GameController::processEvent() {
          processData();
          break;
       case INFORMATIONS:
-         getline(cin, buffer);
+         if (!isStandardInput() && !isExporting()) {
+            // The standard input carries the data, nobody presses enter
+            getline(cin, buffer);
+         }
          break;
       default:
          break;
@@ -108,6 +136,7 @@ void GameController::update() {
          game_state = ANIMATION;
          break;
       case ANIMATION:
+         finishStreaming();
          game_state = ENDING;
          break;
       default:
@@ -133,7 +162,16 @@ void GameController::render() {
       case ENDING:
          if (aborted) {
             renderWarnings();
+         } else if (frames) {
+            renderStreamSummary();
+         }
+
+         if (!aborted) {
+            renderFrameSummary();
+            renderStats();
          }
+
+         renderTrace();
          break;
       default:
          break;
@@ -166,12 +204,23 @@ void GameController::renderWelcome() const {
 // Render a help message with available command-line options
 void GameController::renderHelper() const {
    cout << "Usage: bar-race [<options>] <input_data_file>\n"
+           "  Use \"-\" as input data file to read the standard input.\n"
            "  Bar Chart Race options:\n"
            "\t-b  <num> Max # of bars in a single char.\n"
            "\t\tValid range is [1,15]. Default value is 5.\n"
            "\t-f  <num> Animation speed in fps (frames per second).\n"
-           "\t\tValid range is [1,24]. Default value is 24.\n"
-           "\t-c  <local> Configuration file location.\n";
+           "\t\tValid range is [1,120]. Default value is 24.\n"
+           "\t-c  <local> Configuration file location.\n"
+           "\t--export <file> Write every frame to a file as fast as\n"
+           "\t\tpossible instead of animating them. A \".cast\" file is\n"
+           "\t\trecorded as an asciicast v2, and a \".y4m\" or \".ppm\"\n"
+           "\t\tfile is drawn as a Y4M video or a sequence of PPM images.\n"
+           "\t\tAn \".svg\" file is written as an animated SVG.\n"
+           "\t--stats Print the time spent in each phase of the run at\n"
+           "\t\texit: total, mean, p50, p99 and max.\n"
+           "\t--trace <file> Write when each block was parsed and each\n"
+           "\t\tframe was drawn, written and waited for, on which thread,\n"
+           "\t\tas a Chrome trace (chrome://tracing, ui.perfetto.dev).\n";
 
    cout << program_config.data_file << "\n";
 }
@@ -179,15 +228,31 @@ void GameController::renderHelper() const {
 // Render information about the game and data
 void GameController::renderInformations() const {
    ostringstream oss;
-   oss << ">>> Input file successfully read\n\n";
-   oss << ">>> We have \"" << database.getBarCharts().size()
-       << "\" graphs, with at most \"" << max_number_of_bars << "\" bars\n\n";
+
+   if (parser.joinable()) {
+      oss << ">>> Input file is being read while the animation runs, the "
+             "numbers below are provisional\n\n";
+      oss << ">>> We have \"" << database.getNumberOfBarCharts()
+          << "\" graphs so far, with at most \""
+          << loader->getMaxNumberOfBars() << "\" bars\n\n";
+   } else {
+      oss << ">>> Input file successfully read\n\n";
+      oss << ">>> We have \"" << database.getNumberOfBarCharts()
+          << "\" graphs, with at most \"" << max_number_of_bars
+          << "\" bars\n\n";
+   }
 
    oss << ">>> Title: " << database.getTitle() << "\n";
    oss << ">>> Values is: " << database.getScale() << "\n";
    oss << ">>> Source: " << database.getSource() << "\n";
-   oss << ">>> Number of categories found: " << database.getCategories().size()
-       << "\n\n";
+   oss << ">>> Number of categories found: "
+       << database.getNumberOfCategories() << "\n";
+
+   if (!parser.joinable()) {
+      oss << describeLoad() << "\n";
+   }
+
+   oss << "\n";
 
    oss << ">>> Animation speed is: " << program_config.frames_per_second
        << "\n";
@@ -197,14 +262,143 @@ void GameController::renderInformations() const {
 
    renderWarnings();
 
-   cout << setStyle(">>> Press enter to begin the animation\n", green);
+   if (isExporting()) {
+      cout << setStyle(">>> Exporting the animation to \""
+          + program_config.export_file + "\"\n",
+        green);
+   } else if (isStandardInput()) {
+      cout << setStyle(">>> The animation begins as the data arrives\n", green);
+   } else {
+      cout << setStyle(">>> Press enter to begin the animation\n", green);
+   }
+}
+
+// Render the final numbers of a streamed input file and its warnings
+void GameController::renderStreamSummary() const {
+   ostringstream oss;
+   oss << ">>> Input file completely read\n\n";
+   oss << ">>> We had \"" << database.getNumberOfBarCharts()
+       << "\" graphs, with at most \"" << max_number_of_bars << "\" bars\n";
+   oss << ">>> Number of categories found: "
+       << database.getNumberOfCategories() << "\n";
+   oss << describeLoad() << "\n";
+
+   if (frames->getDropped() != 0) {
+      oss << ">>> Graphs dropped because the animation was behind: "
+          << frames->getDropped() << "\n";
+   }
+
+   if (!database.isComplete()) {
+      oss << ">>> Graphs kept in memory: " << database.getBarCharts().size()
+          << "\n";
+   }
+
+   oss << "\n";
+
+   cout << setStyle(oss.str(), green);
+
+   renderWarnings(stream_warnings);
+}
+
+// Describe the amount of data read and the time it took
+string GameController::describeLoad() const {
+   ostringstream oss;
+   double const megabytes { bytes_read / 1e6 };
+
+   oss << std::fixed << std::setprecision(2);
+   oss << ">>> Read " << megabytes << " MB in " << load_seconds * 1e3
+       << " ms (" << (load_seconds > 0 ? megabytes / load_seconds : 0)
+       << " MB/s, " << loader_name << " loader)";
+
+   return oss.str();
 }
 
 // Render warnings if there are any
 void GameController::renderWarnings() const {
-   if (!program_config.warnings.empty()) {
+   renderWarnings(program_config.warnings);
+}
+
+// Render the numbers of the frames written by the animation
+void GameController::renderFrameSummary() const {
+   size_t const frames_drawn { frame_buffer.getFrames() };
+
+   if (frames_drawn == 0) {
+      return;
+   }
+
+   ostringstream oss;
+   oss << ">>> Frames drawn: " << frames_drawn << ", "
+       << frame_buffer.getTotalBytes() / frames_drawn
+       << " bytes per frame on average (" << frame_buffer.getMaxFrameBytes()
+       << " at most), " << frame_buffer.getWrites() << " writes and "
+       << frame_buffer.getTotalAllocations() << " buffer allocations\n";
+
+   if (isExporting() && !export_written) {
+      // The rates of bytes that never reached the file are not reported
+      cout << setStyle(oss.str() + "\n", green);
+      renderWarnings({ "The export file could not be completely written, "
+                       "the export stopped after "
+        + to_string(frames_drawn) + " frames." });
+      return;
+   }
+
+   if (isExporting()) {
+      double const megabytes { frame_buffer.getTotalBytes() / 1e6 };
+      oss << std::fixed << std::setprecision(2) << ">>> Exported to \""
+          << program_config.export_file << "\" in " << export_seconds
+          << " s: " << (export_seconds > 0 ? frames_drawn / export_seconds : 0)
+          << " frames/s, "
+          << (export_seconds > 0 ? megabytes / export_seconds : 0)
+          << " MB/s\n\n";
+      cout << setStyle(oss.str(), green);
+      return;
+   }
+
+   oss << std::fixed << std::setprecision(2) << ">>> Achieved "
+       << frame_pacer.getAchievedRate() << " fps of "
+       << frame_pacer.getTargetRate() << ", with " << frame_pacer.getJitter()
+       << " ms of jitter, " << frame_pacer.getMaxLateness()
+       << " ms of delay at most, "
+       << frame_pacer.getAverageRenderTime()
+       << " ms to render a frame on average and "
+       << frame_pacer.getDropped() << " frames dropped\n\n";
+
+   cout << setStyle(oss.str(), green);
+}
+
+// Render the time spent in each phase of the run
+void GameController::renderStats() const {
+   if (Profiler::isEnabled()) {
+      cout << setStyle(Profiler::getInstance().getReport(), green);
+   }
+}
+
+// Write the trace events, then render where they went
+void GameController::renderTrace() const {
+   if (!Tracer::isEnabled()) {
+      return;
+   }
+
+   Tracer const& tracer { Tracer::getInstance() };
+
+   if (!tracer.write(program_config.trace_file)) {
+      renderWarnings({ "The trace file \"" + program_config.trace_file
+        + "\" could not be completely written." });
+      return;
+   }
+
+   ostringstream oss;
+   oss << ">>> Trace of " << tracer.getEvents() << " events written to \""
+       << program_config.trace_file << "\" (" << tracer.getDropped()
+       << " older events dropped)\n\n";
+   cout << setStyle(oss.str(), green);
+}
+
+// Render a list of warnings if there are any
+void GameController::renderWarnings(vector<string> const& warnings) const {
+   if (!warnings.empty()) {
       cout << setStyle(">>> Warnings:\n", yellow);
-      for (string warning : program_config.warnings) {
+      for (string warning : warnings) {
          cout << setStyle("\t>>> " + warning + "\n", yellow);
       }
       cout << "\n";
@@ -212,16 +406,61 @@ void GameController::renderWarnings() const {
 }
 
 // Render the drawing using database information
-void GameController::renderDrawing() const {
-   database.draw(program_config.frames_per_second,
-     program_config.bars_size,
-     program_config.number_of_bars,
-     program_config.ticks,
-     program_config.terminal_size);
+void GameController::renderDrawing() {
+   FrameFormat const format { getExportFormat() };
+   frame_buffer.setFormat(format,
+     program_config.frames_per_second,
+     program_config.video_width,
+     program_config.video_height);
+
+   // Frames are only redrawn in place on a terminal, and recordings are
+   // replayed by one
+   frame_buffer.setDifferential(program_config.differential
+     && (format == FORMAT_ASCIICAST
+       || (format == FORMAT_TERMINAL
+         && TerminalScreen::isTerminal(frame_buffer.getOutput()))));
+
+   if (isExporting()) {
+      // Every frame goes to the file as fast as it is rendered
+      frame_buffer.setBatch(EXPORT_BATCH_SIZE);
+      frame_pacer.start(program_config.frames_per_second, PACE_NONE);
+   } else {
+      frame_pacer.start(program_config.frames_per_second,
+        program_config.drop_late_frames ? PACE_DROP : PACE_KEEP);
+   }
+
+   auto const start { std::chrono::steady_clock::now() };
+
+   if (frames) {
+      database.draw(*frames,
+        frame_buffer,
+        frame_pacer,
+        program_config.bars_size,
+        program_config.number_of_bars,
+        program_config.ticks,
+        program_config.terminal_size,
+        program_config.tween_frames);
+   } else {
+      database.draw(frame_buffer,
+        frame_pacer,
+        program_config.bars_size,
+        program_config.number_of_bars,
+        program_config.ticks,
+        program_config.terminal_size,
+        program_config.tween_frames,
+        getRenderThreads());
+   }
+
+   export_written = frame_buffer.close();
+   export_seconds = std::chrono::duration<double>(
+     std::chrono::steady_clock::now() - start)
+                      .count();
 }
 
 // Process configurations from the configuration file
 void GameController::processConfigs() {
+   PROFILE_SCOPE(PHASE_CONFIGS);
+
    try {
       FileIni file { program_config.config_file };
       map<string, string> global_configs { file["global"] };
@@ -257,6 +496,58 @@ void GameController::processConfigs() {
       if (global_configs.find("terminal_size") != global_configs.end()) {
          processTerminalSize(global_configs["terminal_size"]);
       }
+
+      if (global_configs.find("memory_map") != global_configs.end()) {
+         processMemoryMap(global_configs["memory_map"]);
+      }
+
+      if (global_configs.find("parse_threads") != global_configs.end()) {
+         processParseThreads(global_configs["parse_threads"]);
+      }
+
+      if (global_configs.find("cache") != global_configs.end()) {
+         processCache(global_configs["cache"]);
+      }
+
+      if (global_configs.find("value_warnings") != global_configs.end()) {
+         processValueWarnings(global_configs["value_warnings"]);
+      }
+
+      if (global_configs.find("streaming") != global_configs.end()) {
+         processStreaming(global_configs["streaming"]);
+      }
+
+      if (global_configs.find("differential") != global_configs.end()) {
+         processDifferential(global_configs["differential"]);
+      }
+
+      if (global_configs.find("tween_frames") != global_configs.end()) {
+         processTweenFrames(global_configs["tween_frames"]);
+      }
+
+      if (global_configs.find("render_threads") != global_configs.end()) {
+         processRenderThreads(global_configs["render_threads"]);
+      }
+
+      if (global_configs.find("video_size") != global_configs.end()) {
+         processVideoSize(global_configs["video_size"]);
+      }
+
+      if (global_configs.find("late_frames") != global_configs.end()) {
+         processLateFrames(global_configs["late_frames"]);
+      }
+
+      if (global_configs.find("frame_history") != global_configs.end()) {
+         processFrameHistory(global_configs["frame_history"]);
+      }
+
+      if (global_configs.find("stream_queue") != global_configs.end()) {
+         processStreamQueue(global_configs["stream_queue"]);
+      }
+
+      if (global_configs.find("queue_policy") != global_configs.end()) {
+         processQueuePolicy(global_configs["queue_policy"]);
+      }
    } catch (std::runtime_error& e) {
       program_config.warnings.push_back(e.what());
    }
@@ -419,158 +710,437 @@ void GameController::processTerminalSize(string buffer) {
         "will be set.");
    }
 }
-// Open and process data from the input file
-void GameController::processData() {
-   ifstream file { program_config.data_file };
+// Process memory map configuration from the input buffer
+void GameController::processMemoryMap(string buffer) {
+   if (buffer == "true") {
+      program_config.memory_map = true;
+   } else {
+      program_config.memory_map = false;
+   }
+}
 
-   if (!file.is_open()) {
-      // Warn if the data file cannot be opened
+// Process cache configuration from the input buffer
+void GameController::processCache(string buffer) {
+   if (buffer == "true") {
+      program_config.cache = true;
+   } else {
+      program_config.cache = false;
+   }
+}
+
+// Process differential rendering configuration from the input buffer
+void GameController::processDifferential(string buffer) {
+   if (buffer == "true") {
+      program_config.differential = true;
+   } else {
+      program_config.differential = false;
+   }
+}
+
+// Process tween frames configuration from the input buffer
+void GameController::processTweenFrames(string buffer) {
+   try {
+      short tween_converted { static_cast<short>(stoi(buffer)) };
+
+      if (tween_converted < MINIMUM_TWEEN_FRAMES
+        || tween_converted > MAXIMUM_TWEEN_FRAMES) {
+         // Warn if the tween frames are out of range
+         program_config.warnings.push_back(
+           "The value of tween frames must be between ["
+           + to_string(MINIMUM_TWEEN_FRAMES) + ", "
+           + to_string(MAXIMUM_TWEEN_FRAMES)
+           + "]. The default value will be set.");
+      } else {
+         program_config.tween_frames = tween_converted;
+      }
+   } catch (...) {
+      // Warn if the tween frames are not an integer
       program_config.warnings.push_back(
-        "The data file does not exist or cannot be opened.\n Aborted!");
-      aborted = true;
+        "The value of tween frames must be of type integer. The default "
+        "value will be set.");
+   }
+}
+
+// Process render threads configuration from the input buffer
+void GameController::processRenderThreads(string buffer) {
+   try {
+      short threads_converted { static_cast<short>(stoi(buffer)) };
+
+      if (threads_converted < MINIMUM_RENDER_THREADS
+        || threads_converted > MAXIMUM_RENDER_THREADS) {
+         // Warn if the number of threads is out of range
+         program_config.warnings.push_back(
+           "The value of render threads must be between ["
+           + to_string(MINIMUM_RENDER_THREADS) + ", "
+           + to_string(MAXIMUM_RENDER_THREADS)
+           + "]. The default value will be set.");
+      } else {
+         program_config.render_threads = threads_converted;
+      }
+   } catch (...) {
+      // Warn if the number of threads is not an integer
+      program_config.warnings.push_back(
+        "The value of render threads must be of type integer. The default "
+        "value will be set.");
+   }
+}
+
+// Process video size configuration from the input buffer
+void GameController::processVideoSize(string buffer) {
+   if (buffer == "auto") {
+      program_config.video_width = DEFAULT_VIDEO_WIDTH;
+      program_config.video_height = DEFAULT_VIDEO_HEIGHT;
       return;
    }
 
-   string buffer;
+   vector<string> sides { splitWithEmpty(buffer, "x") };
+   bool numbers { sides.size() == 2 };
+   int width_converted { 0 };
+   int height_converted { 0 };
+
+   if (numbers) {
+      try {
+         width_converted = stoi(sides[0]);
+         height_converted = stoi(sides[1]);
+      } catch (...) {
+         numbers = false;
+      }
+   }
+
+   if (!numbers) {
+      // Warn if the video size is not two integers
+      program_config.warnings.push_back(
+        "The value of video size must be \"auto\" or a width and a height "
+        "such as \"1920x1080\". The default value will be set.");
+   } else if (width_converted < MINIMUM_VIDEO_SIZE
+     || width_converted > MAXIMUM_VIDEO_SIZE
+     || height_converted < MINIMUM_VIDEO_SIZE
+     || height_converted > MAXIMUM_VIDEO_SIZE) {
+      // Warn if a side of the video is out of range
+      program_config.warnings.push_back(
+        "The width and height of the video size must be between ["
+        + to_string(MINIMUM_VIDEO_SIZE) + ", " + to_string(MAXIMUM_VIDEO_SIZE)
+        + "]. The default value will be set.");
+   } else {
+      program_config.video_width = static_cast<short>(width_converted);
+      program_config.video_height = static_cast<short>(height_converted);
+   }
+}
+
+// Process late frames configuration from the input buffer
+void GameController::processLateFrames(string buffer) {
+   if (buffer == "drop") {
+      program_config.drop_late_frames = true;
+   } else if (buffer == "keep") {
+      program_config.drop_late_frames = false;
+   } else {
+      // Warn if the policy is unknown
+      program_config.warnings.push_back(
+        "The value of late frames must be \"keep\" or \"drop\". The "
+        "default value will be set.");
+   }
+}
+
+// Process streaming configuration from the input buffer
+void GameController::processStreaming(string buffer) {
+   if (buffer == "true") {
+      program_config.streaming = true;
+   } else {
+      program_config.streaming = false;
+   }
+}
+
+// Process value warnings configuration from the input buffer
+void GameController::processValueWarnings(string buffer) {
+   if (buffer == "true") {
+      program_config.value_warnings = true;
+   } else {
+      program_config.value_warnings = false;
+   }
+}
+
+// Process frame history configuration from the input buffer
+void GameController::processFrameHistory(string buffer) {
+   try {
+      int history_converted { stoi(buffer) };
+
+      if (history_converted < MINIMUM_FRAME_HISTORY
+        || history_converted > MAXIMUM_FRAME_HISTORY) {
+         // Warn if the frame history is out of range
+         program_config.warnings.push_back(
+           "The value of frame history must be between ["
+           + to_string(MINIMUM_FRAME_HISTORY) + ", "
+           + to_string(MAXIMUM_FRAME_HISTORY)
+           + "]. The default value will be set.");
+      } else {
+         program_config.frame_history = history_converted;
+      }
+   } catch (...) {
+      // Warn if the frame history is not an integer
+      program_config.warnings.push_back(
+        "The value of frame history must be of type integer. The default "
+        "value will be set.");
+   }
+}
 
-   for (short header { 0 }; header != HEADER_SIZE; ++header) {
-      getline(file >> std::ws, buffer);
+// Process stream queue configuration from the input buffer
+void GameController::processStreamQueue(string buffer) {
+   try {
+      short queue_converted { static_cast<short>(stoi(buffer)) };
 
-      if (header == 0) {
-         // Set the title of the database from the first line
-         database.setTitle(buffer);
-      } else if (header == 1) {
-         // Set the scale of the database from the second line
-         database.setScale(buffer);
+      if (queue_converted < MINIMUM_STREAM_QUEUE
+        || queue_converted > MAXIMUM_STREAM_QUEUE) {
+         // Warn if the stream queue is out of range
+         program_config.warnings.push_back(
+           "The value of stream queue must be between ["
+           + to_string(MINIMUM_STREAM_QUEUE) + ", "
+           + to_string(MAXIMUM_STREAM_QUEUE)
+           + "]. The default value will be set.");
       } else {
-         // Set the source of the database from the third line
-         database.setSource(buffer);
+         program_config.stream_queue = queue_converted;
       }
+   } catch (...) {
+      // Warn if the stream queue is not an integer
+      program_config.warnings.push_back(
+        "The value of stream queue must be of type integer. The default "
+        "value will be set.");
    }
+}
 
-   int bar_chart_number { 0 };
-   int categories { 0 };
-   bool line_error { false };
-   int quantify_buffer { 0 };
+// Process queue policy configuration from the input buffer
+void GameController::processQueuePolicy(string buffer) {
+   if (buffer == "drop") {
+      program_config.drop_frames = true;
+   } else if (buffer == "block") {
+      program_config.drop_frames = false;
+   } else {
+      // Warn if the policy is unknown
+      program_config.warnings.push_back(
+        "The value of queue policy must be \"block\" or \"drop\". The "
+        "default value will be set.");
+   }
+}
 
-   while (getline(file >> std::ws, buffer)) {
-      int quantify { 0 };
-      string buffer_line;
+// Process parse threads configuration from the input buffer
+void GameController::processParseThreads(string buffer) {
+   try {
+      short threads_converted { static_cast<short>(stoi(buffer)) };
 
-      if (isQuantify(buffer)) {
-         quantify = stoi(buffer);
-      } else if (line_error) {
-         quantify = quantify_buffer;
-         line_error = false;
-         buffer_line = buffer;
+      if (threads_converted < MINIMUM_PARSE_THREADS
+        || threads_converted > MAXIMUM_PARSE_THREADS) {
+         // Warn if the number of threads is out of range
+         program_config.warnings.push_back(
+           "The value of parse threads must be between ["
+           + to_string(MINIMUM_PARSE_THREADS) + ", "
+           + to_string(MAXIMUM_PARSE_THREADS)
+           + "]. The default value will be set.");
+      } else {
+         program_config.parse_threads = threads_converted;
       }
+   } catch (...) {
+      // Warn if the number of threads is not an integer
+      program_config.warnings.push_back(
+        "The value of parse threads must be of type integer. The default "
+        "value will be set.");
+   }
+}
 
-      BarChart* bar_chart = new BarChart();
+// Open and process data from the input file
+void GameController::processData() {
+   auto const start { std::chrono::steady_clock::now() };
 
-      int bar_number { 0 };
-      for (int line { 0 }; line != quantify; ++line) {
-         if (buffer_line.empty()) {
-            getline(file >> std::ws, buffer);
-         } else {
-            buffer = buffer_line;
-            buffer_line.clear();
-         }
+   bool const live { isLiveInput() };
+   int history { program_config.frame_history };
 
-         if (isQuantify(buffer)) {
-            quantify_buffer = stoi(buffer);
-            line_error = true;
+   if (live) {
+      // Live data may never end, so keep it bounded and draw it as it comes
+      history = history == 0 ? LIVE_FRAME_HISTORY : history;
+      program_config.streaming = true;
+      program_config.cache = false;
+   }
 
-            ostringstream oss;
-            oss << "The Number Bar chart " << bar_chart_number
-                << " has less data than specified.";
-            program_config.warnings.push_back(oss.str());
-            break;
-         }
+   database.setHistory(history);
 
-         vector<string> columns { splitWithEmpty(buffer, ",") };
-         string other_info;
+   if (isExporting() && !frame_buffer.open(program_config.export_file)) {
+      // Warn if the export file cannot be created
+      program_config.warnings.push_back(
+        "The export file cannot be created.\n Aborted!");
+      aborted = true;
+      return;
+   }
 
-         bool restart_for { false };
+   DatabaseCache cache { program_config };
+   vector<string> data_warnings;
+
+   if (program_config.cache
+     && cache.load(database, data_warnings, max_number_of_bars)) {
+      // The data file did not change since its cache was written
+      program_config.warnings.insert(program_config.warnings.end(),
+        data_warnings.begin(),
+        data_warnings.end());
+      loader_name = "cache";
+      bytes_read = cache.getBytesRead();
+      load_seconds = std::chrono::duration<double>(
+        std::chrono::steady_clock::now() - start)
+                       .count();
+      return;
+   }
 
-         for (short index { 0 }; index < COLUMNS; ++index) {
-            if (program_config.select_columns[index] != -1
-              && program_config.select_columns[index] > columns.size()) {
-               // Warn if a bar has fewer columns than specified
-               ostringstream oss;
-               oss << "One of the bars in the " << bar_chart_number
-                   << " bar chart has fewer columns than specified";
-               program_config.warnings.push_back(oss.str());
-               restart_for = true;
-               break;
-            }
-         }
+   if (!openData()) {
+      // Warn if the data file cannot be opened
+      program_config.warnings.push_back(
+        "The data file does not exist or cannot be opened.\n Aborted!");
+      aborted = true;
+      return;
+   }
 
-         if (restart_for) {
-            continue;
-         }
+   loader = make_unique<DataLoader>(program_config);
 
-         if (bar_number == 0) {
-            // Set the time stamp of the bar chart from the first column
-            bar_chart->setTimeStamp(columns[program_config.select_columns[0]]);
-         }
+   if (program_config.streaming) {
+      // Parse the bar charts while the first ones are already drawn
+      loader->loadHeader(*reader, database);
+      frames = make_unique<FrameQueue>(program_config.stream_queue,
+        program_config.drop_frames ? QUEUE_DROP_OLDEST : QUEUE_BLOCK);
+      parser = thread(&GameController::streamData, this, start);
+      return;
+   }
 
-         if (program_config.select_columns[2] != -1) {
-            other_info = columns[program_config.select_columns[2]];
-         }
+   loader->load(*reader, database, data_warnings);
+   max_number_of_bars = loader->getMaxNumberOfBars();
 
-         double long value;
+   bytes_read = reader->getBytesRead();
+   load_seconds = std::chrono::duration<double>(
+     std::chrono::steady_clock::now() - start)
+                    .count();
 
-         try {
-            value = stold(columns[program_config.select_columns[3]]);
-         } catch (...) { value = 0; }
-
-         // Create and add a bar to the current bar chart
-         Bar* bar = new Bar(columns[program_config.select_columns[1]],
-           other_info,
-           columns[program_config.select_columns[4]],
-           value);
-
-         short color { green };
-         if (program_config.colors) {
-            // Set color based on configuration
-            color = LIST_OF_COLORS[categories % NUMBER_OF_COLORS];
-         }
+   if (program_config.cache) {
+      // Keep the parsed data for the next runs with the same file
+      cache.save(database, data_warnings, max_number_of_bars);
+   }
 
-         if (database.addCategory(
-               columns[program_config.select_columns[4]], color)) {
-            // Add category to the database and track the number of categories
-            ++categories;
-         }
+   program_config.warnings.insert(program_config.warnings.end(),
+     data_warnings.begin(),
+     data_warnings.end());
+}
 
-         bar_chart->addBar(bar);
+// Check if the data comes from the standard input
+bool GameController::isStandardInput() const {
+   return program_config.data_file == STDIN_DATA_FILE;
+}
 
-         ++bar_number;
-      }
+// Check if the frames are exported to a file
+bool GameController::isExporting() const {
+   return !program_config.export_file.empty();
+}
 
-      if (max_number_of_bars < bar_number) {
-         // Update the maximum number of bars encountered
-         max_number_of_bars = bar_number;
-      }
+// Get the format of the frames
+FrameFormat GameController::getExportFormat() const {
+   if (!isExporting()) {
+      return FORMAT_TERMINAL;
+   }
+
+   std::filesystem::path const extension {
+      std::filesystem::path(program_config.export_file).extension()
+   };
+
+   if (extension == CAST_EXTENSION) {
+      return FORMAT_ASCIICAST;
+   } else if (extension == Y4M_EXTENSION) {
+      return FORMAT_Y4M;
+   } else if (extension == PPM_EXTENSION) {
+      return FORMAT_PPM;
+   } else if (extension == SVG_EXTENSION) {
+      return FORMAT_SVG;
+   }
+
+   return FORMAT_TERMINAL;
+}
 
-      // Add the completed bar chart to the database
-      database.addBarChart(bar_chart);
+// Get the number of threads that compose the frames
+unsigned GameController::getRenderThreads() const {
+   if (!isExporting()) {
+      // The frames of a live animation are paced one by one
+      return 1;
+   }
 
-      ++bar_chart_number;
+   if (program_config.render_threads > 0) {
+      return program_config.render_threads;
    }
+
+   unsigned const hardware { thread::hardware_concurrency() };
+   return hardware == 0 ? 1 : hardware;
 }
 
-// Check if a given string can be converted to an integer, indicating a quantity
-bool GameController::isQuantify(string line) {
-   try {
-      size_t pos;
-      int buffer = std::stoi(line, &pos);
+// Check if the data arrives while it is read
+bool GameController::isLiveInput() const {
+   std::error_code error;
+   std::filesystem::file_status const status { std::filesystem::status(
+     program_config.data_file, error) };
+
+   return isStandardInput()
+     || (!error && std::filesystem::exists(status)
+       && !std::filesystem::is_regular_file(status));
+}
+
+// Open the data file with the memory-mapped or the stream reader
+bool GameController::openData() {
+   if (isStandardInput()) {
+      reader = make_unique<StreamLineReader>(cin);
+      loader_name = "stdin";
+      return true;
+   }
 
-      // If the conversion position matches the trimmed line length, it's a
-      // quantity
-      if (pos == trim(line).length()) {
+   if (program_config.memory_map) {
+      try {
+         mapped_file.open(program_config.data_file);
+         reader = make_unique<MappedLineReader>(mapped_file.getView());
+         loader_name = "mmap";
          return true;
-      } else {
-         return false;
+      } catch (std::runtime_error&) {
+         // Fall back to the stream reader below
       }
-   } catch (...) { return false; }
+   }
+
+   data_stream.open(program_config.data_file);
+
+   if (!data_stream.is_open()) {
+      return false;
+   }
+
+   reader = make_unique<StreamLineReader>(data_stream);
+   loader_name = "stream";
+
+   return true;
+}
+
+// Parse the bar charts of the data file in the parser thread
+void GameController::streamData(
+  std::chrono::steady_clock::time_point start) {
+   bool const complete { loader->loadBlocks(
+     *reader, database, stream_warnings, frames.get()) };
+
+   bytes_read = reader->getBytesRead();
+   load_seconds = std::chrono::duration<double>(
+     std::chrono::steady_clock::now() - start)
+                    .count();
+
+   if (program_config.cache && complete) {
+      // Keep the parsed data for the next runs with the same file, unless
+      // the animation stopped before the whole file was read
+      DatabaseCache cache { program_config };
+      cache.save(database, stream_warnings, loader->getMaxNumberOfBars());
+   }
+}
+
+// Wait for the parser thread and collect its results
+void GameController::finishStreaming() {
+   if (!parser.joinable()) {
+      return;
+   }
+
+   // Unblock the parser if the animation stopped early
+   frames->close();
+   parser.join();
+
+   max_number_of_bars = loader->getMaxNumberOfBars();
 }
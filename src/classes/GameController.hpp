@@ -33,8 +33,13 @@ using fos::splitWithEmpty;
 using fos::trim;
 using fos::foreground::green;
 
+#include "DataLoader.hpp"
 #include "Database.hpp"
+#include "DatabaseCache.hpp"
 #include "fileini.hpp"
+#include "linereader.hpp"
+#include "mappedfile.hpp"
+#include "profiler.hpp" /// Profiler, PROFILE_SCOPE, Tracer
 
 #include <iostream> /// cerr, cin, cout
 using std::cerr;
@@ -51,36 +56,61 @@ using std::stoi;
 using std::stold;
 using std::string;
 
+#include <string_view> /// string_view
+using std::string_view;
+
+#include <memory> /// unique_ptr, make_unique
+using std::make_unique;
+using std::unique_ptr;
+
+#include <chrono> /// steady_clock, duration
+
+#include <thread> /// thread, hardware_concurrency
+using std::thread;
+
 #include <map> /// map
 using std::map;
 
 #include <sstream> /// ostringstream
 using std::ostringstream;
 
+#include <iomanip> /// setprecision
+
 #include <fstream> /// ifstream
 using std::ifstream;
 
+#include <filesystem> /// status, exists, is_regular_file
+
 constexpr short MINIMUM_TICKS { 0 }; ///< Minimum number of ticks >//
 constexpr short MINIMUM_TERMINAL_SIZE { 20 }; ///< Minimum terminal size >//
 constexpr short MAXIMUM_TERMINAL_SIZE { 512 }; ///< Maximum terminal size >//
-constexpr short HEADER_SIZE { 3 }; ///< Header size >//
-
-short const LIST_OF_COLORS[NUMBER_OF_COLORS] = {
-   fos::foreground::red,
-   fos::foreground::green,
-   fos::foreground::yellow,
-   fos::foreground::blue,
-   fos::foreground::magenta,
-   fos::foreground::cyan,
-   fos::foreground::white,
-   fos::foreground::bright_red,
-   fos::foreground::bright_green,
-   fos::foreground::bright_yellow,
-   fos::foreground::bright_blue,
-   fos::foreground::bright_magenta,
-   fos::foreground::bright_cyan,
-   fos::foreground::bright_white,
-}; ///< List of colors used in categories >//
+constexpr short MINIMUM_PARSE_THREADS { 0 }; ///< Minimum parse threads >//
+constexpr short MAXIMUM_PARSE_THREADS { 256 }; ///< Maximum parse threads >//
+constexpr int MINIMUM_FRAME_HISTORY { 0 }; ///< Minimum frame history >//
+constexpr int MAXIMUM_FRAME_HISTORY { 1000000 }; ///< Maximum frame history >//
+constexpr short MINIMUM_STREAM_QUEUE { 1 }; ///< Minimum stream queue >//
+constexpr short MAXIMUM_STREAM_QUEUE { 4096 }; ///< Maximum stream queue >//
+constexpr short MINIMUM_TWEEN_FRAMES { 1 }; ///< Minimum tween frames >//
+constexpr short MAXIMUM_TWEEN_FRAMES { 120 }; ///< Maximum tween frames >//
+constexpr short MINIMUM_RENDER_THREADS { 0 }; ///< Minimum render threads >//
+constexpr short MAXIMUM_RENDER_THREADS { 256 }; ///< Maximum render threads >//
+constexpr short MINIMUM_VIDEO_SIZE { 64 }; ///< Minimum video side >//
+constexpr short MAXIMUM_VIDEO_SIZE { 8192 }; ///< Maximum video side >//
+constexpr size_t EXPORT_BATCH_SIZE {
+   1 << 20
+}; ///< Bytes of frames written at once to the export file >//
+constexpr char const* CAST_EXTENSION {
+   ".cast"
+}; ///< Extension of the export files recorded as asciicasts >//
+constexpr char const* Y4M_EXTENSION {
+   ".y4m"
+}; ///< Extension of the export files drawn as Y4M videos >//
+constexpr char const* PPM_EXTENSION {
+   ".ppm"
+}; ///< Extension of the export files drawn as PPM sequences >//
+constexpr char const* SVG_EXTENSION {
+   ".svg"
+}; ///< Extension of the export files written as animated SVGs >//
 
 /**
  * @brief GameController class that controls the game flow
@@ -117,14 +147,12 @@ class GameController {
    GameController() = default;
 
    /**
-    * @brief Default destructor for GameController
+    * @brief Destructor for GameController
     *
-    * This destructor is explicitly defaulted, indicating the default behavior
-    * for destroying instances of the GameController class. It does not perform
-    * any custom cleanup or resource release because the class does not manage
-    * any dynamically allocated resources.
+    * If the data file is still being parsed by the parser thread, the thread
+    * is stopped and joined before the data it uses is destroyed.
     */
-   ~GameController() = default;
+   ~GameController();
 
    /**
     * @brief Destroy the singleton instance of GameController
@@ -167,6 +195,20 @@ class GameController {
    Database database; ///< Database used by the game
    short max_number_of_bars { 0 }; ///< Maximum number of bars
    bool aborted { false }; ///< Flag indicating if the game was aborted
+   MappedFile mapped_file; ///< Data file, when it is memory-mapped
+   ifstream data_stream; ///< Data file, when it is read through a stream
+   unique_ptr<LineReader> reader; ///< Source of lines of the data file
+   unique_ptr<DataLoader> loader; ///< Loader of the data file
+   unique_ptr<FrameQueue> frames; ///< Bar charts parsed while drawing
+   thread parser; ///< Thread parsing the data file while drawing
+   vector<string> stream_warnings; ///< Warnings raised by the parser thread
+   string loader_name; ///< Name of the loader used to read the data file
+   size_t bytes_read { 0 }; ///< Number of bytes read from the data file
+   double load_seconds { 0 }; ///< Time spent reading the data file
+   FrameBuffer frame_buffer; ///< Buffer composing each frame of the animation
+   FramePacer frame_pacer; ///< Scheduler of the frames of the animation
+   double export_seconds { 0 }; ///< Time spent exporting the animation
+   bool export_written { true }; ///< Every frame exported was written
 
    /**
     * @brief Deleted copy constructor
@@ -207,15 +249,49 @@ class GameController {
     */
    void renderInformations() const;
 
+   /**
+    * @brief Render the final numbers of a streamed data file and its warnings
+    */
+   void renderStreamSummary() const;
+
+   /**
+    * @brief Describe the amount of data read and the time it took
+    * @return Description of the load
+    */
+   string describeLoad() const;
+
    /**
     * @brief Render warnings
     */
    void renderWarnings() const;
 
+   /**
+    * @brief Render a list of warnings
+    * @param warnings The warnings to render
+    */
+   void renderWarnings(vector<string> const& warnings) const;
+
    /**
     * @brief Render the drawing
     */
-   void renderDrawing() const;
+   void renderDrawing();
+
+   /**
+    * @brief Render the numbers of the frames written by the animation and of
+    * their pacing
+    */
+   void renderFrameSummary() const;
+
+   /**
+    * @brief Render the time spent in each phase of the run, if asked for
+    */
+   void renderStats() const;
+
+   /**
+    * @brief Write the trace events to the trace file and render where they
+    * went, if asked for
+    */
+   void renderTrace() const;
 
    /**
     * @brief Process game configurations
@@ -264,17 +340,143 @@ class GameController {
     */
    void processTerminalSize(string buffer);
 
+   /**
+    * @brief Process memory map configuration
+    * @param buffer The input buffer containing memory map data
+    */
+   void processMemoryMap(string buffer);
+
+   /**
+    * @brief Process streaming configuration
+    * @param buffer The input buffer containing streaming data
+    */
+   void processStreaming(string buffer);
+
+   /**
+    * @brief Process value warnings configuration
+    * @param buffer The input buffer containing value warnings data
+    */
+   void processValueWarnings(string buffer);
+
+   /**
+    * @brief Process frame history configuration
+    * @param buffer The input buffer containing frame history data
+    */
+   void processFrameHistory(string buffer);
+
+   /**
+    * @brief Process stream queue configuration
+    * @param buffer The input buffer containing stream queue data
+    */
+   void processStreamQueue(string buffer);
+
+   /**
+    * @brief Process queue policy configuration
+    * @param buffer The input buffer containing queue policy data
+    */
+   void processQueuePolicy(string buffer);
+
+   /**
+    * @brief Process parse threads configuration
+    * @param buffer The input buffer containing parse threads data
+    */
+   void processParseThreads(string buffer);
+
+   /**
+    * @brief Process cache configuration
+    * @param buffer The input buffer containing cache data
+    */
+   void processCache(string buffer);
+
+   /**
+    * @brief Process tween frames configuration
+    * @param buffer The input buffer containing tween frames data
+    */
+   void processTweenFrames(string buffer);
+
+   /**
+    * @brief Process render threads configuration
+    * @param buffer The input buffer containing render threads data
+    */
+   void processRenderThreads(string buffer);
+
+   /**
+    * @brief Process video size configuration
+    * @param buffer The input buffer containing video size data
+    */
+   void processVideoSize(string buffer);
+
+   /**
+    * @brief Process late frames configuration
+    * @param buffer The input buffer containing late frames data
+    */
+   void processLateFrames(string buffer);
+
+   /**
+    * @brief Process differential rendering configuration
+    * @param buffer The input buffer containing differential rendering data
+    */
+   void processDifferential(string buffer);
+
    /**
     * @brief Process game data
+    *
+    * A valid cache of the data file is used when there is one. Otherwise, the
+    * data file is memory-mapped when possible, so lines and columns are views
+    * into the mapped region, or read through a stream, and the cache is
+    * written for the next runs. Live inputs are always streamed.
     */
    void processData();
 
    /**
-    * @brief Check if a line contains a "quantify" command
-    * @param line The line to check
-    * @return true if the line contains a "quantify" command, false otherwise
+    * @brief Check if the data comes from the standard input
+    * @return true if the data file is STDIN_DATA_FILE, false otherwise
+    */
+   bool isStandardInput() const;
+
+   /**
+    * @brief Check if the data arrives while it is read, as from the standard
+    * input or a named pipe
+    * @return true if the data file is not a regular file, false otherwise
+    */
+   bool isLiveInput() const;
+
+   /**
+    * @brief Check if the frames are exported to a file instead of animated
+    * @return true if an export file was given, false otherwise
+    */
+   bool isExporting() const;
+
+   /**
+    * @brief Get the number of threads that compose the frames, which is 1
+    * unless the animation is exported
+    * @return Number of threads
+    */
+   unsigned getRenderThreads() const;
+
+   /**
+    * @brief Get the format of the frames, from the extension of the export
+    * file
+    * @return The format (FORMAT_TERMINAL when the animation is not exported)
+    */
+   FrameFormat getExportFormat() const;
+
+   /**
+    * @brief Open the data file with the memory-mapped or the stream reader
+    * @return true if the data file was opened, false otherwise
+    */
+   bool openData();
+
+   /**
+    * @brief Parse the bar charts of the data file in the parser thread
+    * @param start Time at which the processing of the data started
+    */
+   void streamData(std::chrono::steady_clock::time_point start);
+
+   /**
+    * @brief Wait for the parser thread and collect its results
     */
-   bool isQuantify(string line);
+   void finishStreaming();
 };
 
 #endif /// GAME_CONTROLLER_HPP_
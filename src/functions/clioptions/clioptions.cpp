@@ -60,7 +60,8 @@ void CLIOptions::getConfigs(int arguments_count, char* arguments[]) {
       } else if (argument->type == NONE) {
          string unknown_argument { arguments[index] };
 
-         if (unknown_argument[0] == '-') {
+         if (unknown_argument[0] == '-'
+           && unknown_argument != STDIN_DATA_FILE) {
             ostringstream oss;
             oss << "Unknow option: \"" << unknown_argument << "\"";
             program_configs.warnings.push_back(oss.str());
@@ -97,6 +98,8 @@ Argument const* CLIOptions::verifyArgument(char* argument) const {
 void CLIOptions::getBasicConfig(Argument const* argument) {
    if (argument == &arguments[ARG_HELP]) {
       program_configs.help_menu = true;
+   } else if (argument == &arguments[ARG_STATS]) {
+      program_configs.stats = true;
    }
 }
 
@@ -174,6 +177,28 @@ void CLIOptions::getCompostConfig(
       } else {
          program_configs.config_file = complementary;
       }
+   } else if (argument == &arguments[ARG_EXPORT]) {
+      complementary = trim(complementary);
+
+      if (complementary.empty()) {
+         ostringstream oss;
+         oss << "The value of \"" << argument->code
+             << "\" cannot be empty. Entry disregarded.";
+         program_configs.warnings.push_back(oss.str());
+      } else {
+         program_configs.export_file = complementary;
+      }
+   } else if (argument == &arguments[ARG_TRACE]) {
+      complementary = trim(complementary);
+
+      if (complementary.empty()) {
+         ostringstream oss;
+         oss << "The value of \"" << argument->code
+             << "\" cannot be empty. Entry disregarded.";
+         program_configs.warnings.push_back(oss.str());
+      } else {
+         program_configs.trace_file = complementary;
+      }
    }
 }
 
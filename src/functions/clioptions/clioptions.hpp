@@ -34,7 +34,7 @@ constexpr short FIRST_ARGUMENT_INDEX {
 
 constexpr short MINIMUM_FPS { 1 }; ///< Defining a minimum fps accepted
 
-constexpr short MAXIMUM_FPS { 24 }; ///< Defining a maximum fps accepted
+constexpr short MAXIMUM_FPS { 120 }; ///< Defining a maximum fps accepted
 
 constexpr short MINIMUM_BARS { 1 }; ///< Defining a minimum bars accepted
 
@@ -71,6 +71,9 @@ Argument const arguments[] = { { BASIC, "-h", false }, /// Helper argument
    { COMPOST, "-b", false }, /// Bars config
    { COMPOST, "-s", false }, /// Bars size config
    { COMPOST, "-c", false }, /// File config
+   { COMPOST, "--export", false }, /// Export file
+   { BASIC, "--stats", false }, /// Phase statistics
+   { COMPOST, "--trace", false }, /// Trace file
    { NONE, std::string() } }; /// This is an empty argument
 
 /**
@@ -82,6 +85,9 @@ enum ArgumentsEnumeration {
    ARG_BARS, /// Bars
    ARG_BARS_SIZE, /// Bars size
    ARG_FILE_CONFIG, /// File config
+   ARG_EXPORT, /// Export file
+   ARG_STATS, /// Phase statistics
+   ARG_TRACE, /// Trace file
    ARG_UNDEFINED, /// Undefined
 };
 
@@ -35,6 +35,52 @@ constexpr short DEFAULT_NUMBER_OF_TICKS { 5 }; ///< Default number of ticks
 /// Default terminal size (introduced comment)
 constexpr short DEFAULT_TERMINAL_SIZE { 80 }; ///< Default terminal size
 
+/// Default memory mapping of the data file
+constexpr bool DEFAULT_MEMORY_MAP { true };
+
+/// Default number of threads used to parse the data file (0: all cores)
+constexpr short DEFAULT_PARSE_THREADS { 0 };
+
+/// Default use of a binary cache of the data file
+constexpr bool DEFAULT_CACHE { true };
+
+/// Default warnings for the values that are not numbers or out of range
+constexpr bool DEFAULT_VALUE_WARNINGS { false };
+
+/// Default drawing of the data while it is parsed
+constexpr bool DEFAULT_STREAMING { false };
+
+/// Default number of bar charts kept in memory (0: all)
+constexpr int DEFAULT_FRAME_HISTORY { 0 };
+
+/// Number of bar charts kept in memory for live inputs when not configured
+constexpr int LIVE_FRAME_HISTORY { 256 };
+
+/// Default number of bar charts parsed ahead of the animation
+constexpr short DEFAULT_STREAM_QUEUE { 64 };
+
+/// Default policy when the animation is behind: drop old bar charts or wait
+constexpr bool DEFAULT_DROP_FRAMES { false };
+
+/// Default number of frames drawn from a bar chart to the next one
+constexpr short DEFAULT_TWEEN_FRAMES { 1 };
+
+/// Default number of threads composing the frames of an export (0: all cores)
+constexpr short DEFAULT_RENDER_THREADS { 0 };
+
+/// Default size of the images of a video export (0: sized after the frames)
+constexpr short DEFAULT_VIDEO_WIDTH { 0 };
+constexpr short DEFAULT_VIDEO_HEIGHT { 0 };
+
+/// Default policy when a frame is late: drop it or draw it
+constexpr bool DEFAULT_DROP_LATE_FRAMES { false };
+
+/// Default redrawing of only the cells that changed between frames
+constexpr bool DEFAULT_DIFFERENTIAL { true };
+
+/// Data file name that reads the data from the standard input
+constexpr char const* STDIN_DATA_FILE { "-" };
+
 /// Default help menu
 constexpr bool DEFAULT_HELP_MENU { false };
 
@@ -61,10 +107,31 @@ struct ProgramConfig {
    short ticks { DEFAULT_NUMBER_OF_TICKS }; ///< Number of ticks
    short terminal_size { DEFAULT_TERMINAL_SIZE }; ///< Terminal size
    bool colors { DEFAULT_ENABLE_COLORS }; ///< Enable colors
+   bool memory_map { DEFAULT_MEMORY_MAP }; ///< Memory-map the data file
+   short parse_threads { DEFAULT_PARSE_THREADS }; ///< Parse threads
+   bool cache { DEFAULT_CACHE }; ///< Use a binary cache of the data file
+   bool value_warnings {
+      DEFAULT_VALUE_WARNINGS
+   }; ///< Warn about the values that could not be parsed
+   bool streaming { DEFAULT_STREAMING }; ///< Draw the data while parsing it
+   int frame_history { DEFAULT_FRAME_HISTORY }; ///< Bar charts kept in memory
+   short stream_queue { DEFAULT_STREAM_QUEUE }; ///< Bar charts parsed ahead
+   bool drop_frames { DEFAULT_DROP_FRAMES }; ///< Drop old bar charts if behind
+   short tween_frames { DEFAULT_TWEEN_FRAMES }; ///< Frames per bar chart
+   short render_threads { DEFAULT_RENDER_THREADS }; ///< Export threads
+   short video_width { DEFAULT_VIDEO_WIDTH }; ///< Width of exported images
+   short video_height { DEFAULT_VIDEO_HEIGHT }; ///< Height of exported images
+   bool drop_late_frames {
+      DEFAULT_DROP_LATE_FRAMES
+   }; ///< Skip the frames drawn too late
+   bool differential { DEFAULT_DIFFERENTIAL }; ///< Redraw only changed cells
    bool help_menu { DEFAULT_HELP_MENU }; ///< Help menu
+   bool stats { false }; ///< Print the time spent in each phase at exit
    vector<string> warnings; ///< Warnings list
    string data_file; ///< Data file local
    string config_file; ///< Config file local
+   string export_file; ///< File receiving the frames (empty: terminal)
+   string trace_file; ///< File receiving the trace events (empty: none)
 };
 
 #endif /// UTILS_HPP_
@@ -0,0 +1,144 @@
+/**
+ * @file boundedqueue.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a blocking queue with a maximum capacity, used to hand items
+ * from a producer thread to a consumer thread.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef BOUNDED_QUEUE_HPP_
+#define BOUNDED_QUEUE_HPP_
+
+#include <condition_variable> /// condition_variable
+#include <deque> /// deque
+#include <mutex> /// mutex, unique_lock, lock_guard
+
+/**
+ * @brief What a producer does when the queue is full
+ */
+enum QueuePolicy {
+   QUEUE_BLOCK, ///< Wait until the consumer removes an item (backpressure)
+   QUEUE_DROP_OLDEST, ///< Drop the oldest item to make room
+};
+
+/**
+ * @brief Blocking first-in first-out queue with a maximum capacity
+ *
+ * The consumer waits while the queue is empty. When the queue is full, the
+ * producer either waits or drops the oldest item, depending on the policy.
+ * Closing the queue wakes both sides: the producer stops pushing and the
+ * consumer drains what is left.
+ *
+ * @tparam T Type of the items
+ */
+template <typename T>
+class BoundedQueue {
+   public:
+   /**
+    * @brief Constructor for the BoundedQueue class
+    * @param _capacity Maximum number of items in the queue (default: 1)
+    * @param _policy What to do when the queue is full (default: QUEUE_BLOCK)
+    */
+   BoundedQueue(size_t _capacity = 1, QueuePolicy _policy = QUEUE_BLOCK)
+       : capacity(_capacity == 0 ? 1 : _capacity), policy(_policy) { }
+
+   /**
+    * @brief Add an item, waiting or dropping the oldest item while the queue
+    * is full
+    * @param item The item to add
+    * @return true if the item was added, false if the queue is closed
+    */
+   bool push(T item) {
+      std::unique_lock<std::mutex> lock { mutex };
+
+      if (policy == QUEUE_DROP_OLDEST && !closed && items.size() >= capacity) {
+         items.pop_front();
+         ++dropped;
+      }
+
+      not_full.wait(lock, [this]() { return closed || items.size() < capacity; });
+
+      if (closed) {
+         return false;
+      }
+
+      items.push_back(std::move(item));
+      not_empty.notify_one();
+
+      return true;
+   }
+
+   /**
+    * @brief Remove the oldest item, waiting while the queue is empty
+    * @param item Receives the item
+    * @return true if an item was removed, false if the queue is closed and
+    * empty
+    */
+   bool pop(T& item) {
+      std::unique_lock<std::mutex> lock { mutex };
+      not_empty.wait(lock, [this]() { return closed || !items.empty(); });
+
+      if (items.empty()) {
+         return false;
+      }
+
+      item = std::move(items.front());
+      items.pop_front();
+      not_full.notify_one();
+
+      return true;
+   }
+
+   /**
+    * @brief Close the queue, no more items can be added
+    */
+   void close() {
+      std::lock_guard<std::mutex> lock { mutex };
+      closed = true;
+      not_empty.notify_all();
+      not_full.notify_all();
+   }
+
+   /**
+    * @brief Check if the queue has no item waiting, without blocking
+    * @return true if the queue is empty, false otherwise
+    */
+   bool empty() const {
+      std::lock_guard<std::mutex> lock { mutex };
+      return items.empty();
+   }
+
+   /**
+    * @brief Check if the queue was closed
+    * @return true if the queue is closed, false otherwise
+    */
+   bool isClosed() const {
+      std::lock_guard<std::mutex> lock { mutex };
+      return closed;
+   }
+
+   /**
+    * @brief Get the number of items dropped to make room for new ones
+    * @return Number of dropped items
+    */
+   size_t getDropped() const {
+      std::lock_guard<std::mutex> lock { mutex };
+      return dropped;
+   }
+
+   private:
+   std::deque<T> items; ///< Items in the queue, oldest first
+   size_t capacity; ///< Maximum number of items
+   QueuePolicy policy; ///< What to do when the queue is full
+   size_t dropped { 0 }; ///< Number of items dropped to make room
+   bool closed { false }; ///< Flag indicating if the queue was closed
+   mutable std::mutex mutex; ///< Mutex guarding the queue
+   std::condition_variable not_empty; ///< Signaled when an item is added
+   std::condition_variable not_full; ///< Signaled when an item is removed
+};
+
+#endif /// BOUNDED_QUEUE_HPP_
@@ -0,0 +1,114 @@
+/**
+ * @file ringbuffer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a sequence container that keeps only its most recent items.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef RING_BUFFER_HPP_
+#define RING_BUFFER_HPP_
+
+#include <vector> /// vector
+
+/**
+ * @brief Sequence that keeps at most a fixed number of items, overwriting the
+ * oldest one when a new item is added to a full buffer
+ *
+ * A capacity of 0 makes the buffer unbounded, in which case it behaves like a
+ * vector. Items are indexed from the oldest (0) to the newest (size() - 1).
+ *
+ * @tparam T Type of the items
+ */
+template <typename T>
+class RingBuffer {
+   public:
+   /**
+    * @brief Constructor for the RingBuffer class
+    * @param _capacity Maximum number of items (default: 0, unbounded)
+    */
+   RingBuffer(size_t _capacity = 0) : capacity(_capacity) {
+      items.reserve(capacity);
+   }
+
+   /**
+    * @brief Add an item after the newest one, dropping the oldest one if the
+    * buffer is full
+    * @param item The item to add
+    */
+   void push_back(T item) {
+      ++total;
+
+      if (capacity == 0 || items.size() < capacity) {
+         items.push_back(std::move(item));
+      } else {
+         items[head] = std::move(item);
+         head = (head + 1) % capacity;
+      }
+   }
+
+   /**
+    * @brief Access an item
+    * @param index Position of the item, from the oldest one
+    * @return Reference to the item
+    */
+   T const& operator[](size_t index) const {
+      return items[capacity == 0 ? index : (head + index) % items.size()];
+   }
+
+   /**
+    * @brief Get the number of items in the buffer
+    * @return Number of items
+    */
+   size_t size() const {
+      return items.size();
+   }
+
+   /**
+    * @brief Check if the buffer has no items
+    * @return true if the buffer is empty, false otherwise
+    */
+   bool empty() const {
+      return items.empty();
+   }
+
+   /**
+    * @brief Get the number of items ever added, including the dropped ones
+    * @return Number of items added
+    */
+   size_t getTotal() const {
+      return total;
+   }
+
+   /**
+    * @brief Get the maximum number of items
+    * @return Capacity of the buffer (0 if unbounded)
+    */
+   size_t getCapacity() const {
+      return capacity;
+   }
+
+   /**
+    * @brief Remove every item and change the capacity
+    * @param _capacity Maximum number of items (0 for unbounded)
+    */
+   void reset(size_t _capacity) {
+      items.clear();
+      items.shrink_to_fit();
+      items.reserve(_capacity);
+      capacity = _capacity;
+      head = 0;
+      total = 0;
+   }
+
+   private:
+   std::vector<T> items; ///< Storage of the items
+   size_t capacity; ///< Maximum number of items (0 if unbounded)
+   size_t head { 0 }; ///< Position of the oldest item once the buffer is full
+   size_t total { 0 }; ///< Number of items ever added
+};
+
+#endif /// RING_BUFFER_HPP_
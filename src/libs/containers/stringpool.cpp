@@ -0,0 +1,162 @@
+/**
+ * @file stringpool.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the StringPool class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "stringpool.hpp"
+
+// Get the instance shared by the whole program
+StringPool& StringPool::getInstance() {
+   // Initialized once, even when the first calls come from several threads
+   static StringPool instance;
+   return instance;
+}
+
+// Construct an empty pool, holding only the empty string
+StringPool::StringPool() {
+   std::unique_lock<std::shared_mutex> lock { pool_mutex };
+   add(string_view());
+}
+
+// Free the chunks of views
+StringPool::~StringPool() {
+   for (std::atomic<string_view*>& chunk : chunks) {
+      delete[] chunk.load(std::memory_order_relaxed);
+   }
+}
+
+// Get the id of a string, adding it to the pool if needed
+uint32_t StringPool::intern(string_view text) {
+   {
+      std::shared_lock<std::shared_mutex> lock { pool_mutex };
+      auto const found { ids.find(text) };
+
+      if (found != ids.end()) {
+         return found->second;
+      }
+   }
+
+   std::unique_lock<std::shared_mutex> lock { pool_mutex };
+
+   // Another thread may have added it while the lock was released
+   auto const found { ids.find(text) };
+
+   if (found != ids.end()) {
+      return found->second;
+   }
+
+   return add(text);
+}
+
+// Store a new text and publish its id
+uint32_t StringPool::add(string_view text) {
+   if (!free_ids.empty()) {
+      // Reuse a reclaimed id, whose view nobody reads anymore
+      uint32_t const id { free_ids.back() };
+      free_ids.pop_back();
+
+      texts[id] = string(text);
+      chunks[id >> CHUNK_BITS].load(
+        std::memory_order_relaxed)[id & (CHUNK_SIZE - 1)]
+        = texts[id];
+      ids.emplace(texts[id], id);
+
+      return id;
+   }
+
+   uint32_t const id { count.load(std::memory_order_relaxed) };
+   std::atomic<string_view*>& chunk { chunks[id >> CHUNK_BITS] };
+   string_view* views { chunk.load(std::memory_order_relaxed) };
+
+   if (views == nullptr) {
+      views = new string_view[CHUNK_SIZE];
+      chunk.store(views, std::memory_order_release);
+   }
+
+   texts.emplace_back(text);
+   views[id & (CHUNK_SIZE - 1)] = texts.back();
+   ids.emplace(texts.back(), id);
+
+   // The view is written before the id can be seen by another thread
+   count.store(id + 1, std::memory_order_release);
+
+   return id;
+}
+
+// Get the text of an id
+string_view StringPool::resolve(uint32_t id) const {
+   // The id came from intern(), so its view was published before it
+   string_view const* views {
+      chunks[id >> CHUNK_BITS].load(std::memory_order_acquire)
+   };
+
+   return views[id & (CHUNK_SIZE - 1)];
+}
+
+// Get the number of distinct strings in the pool
+size_t StringPool::size() const {
+   std::shared_lock<std::shared_mutex> lock { pool_mutex };
+   return texts.size() - free_ids.size();
+}
+
+// Get the number of times strings were reclaimed
+size_t StringPool::getGeneration() const {
+   return generation.load(std::memory_order_acquire);
+}
+
+// Free the strings whose ids are not marked as live
+size_t StringPool::reclaim(vector<bool> const& live) {
+   std::unique_lock<std::shared_mutex> lock { pool_mutex };
+
+   // Ids already free are not freed twice
+   vector<bool> freed(texts.size(), false);
+
+   for (uint32_t id : free_ids) {
+      freed[id] = true;
+   }
+
+   // The empty string (id 0) is never freed
+   for (uint32_t id { 1 }; id < texts.size(); ++id) {
+      if (freed[id] || (id < live.size() && live[id])) {
+         continue;
+      }
+
+      ids.erase(texts[id]);
+      string().swap(texts[id]);
+      free_ids.push_back(id);
+   }
+
+   // Caches holding the freed ids must be dropped before their next lookup
+   generation.fetch_add(1, std::memory_order_release);
+
+   return texts.size() - free_ids.size();
+}
+
+// Get the id of a string, from the cache or else from the pool
+uint32_t StringCache::intern(string_view text) {
+   StringPool& pool { StringPool::getInstance() };
+   size_t const current { pool.getGeneration() };
+
+   if (generation != current) {
+      // Some of the ids, and the texts the keys view, may have been freed
+      ids.clear();
+      generation = current;
+   }
+
+   auto const found { ids.find(text) };
+
+   if (found != ids.end()) {
+      return found->second;
+   }
+
+   uint32_t const id { pool.intern(text) };
+   ids.emplace(pool.resolve(id), id);
+
+   return id;
+}
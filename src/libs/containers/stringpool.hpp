@@ -0,0 +1,170 @@
+/**
+ * @file stringpool.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a table that stores each distinct string once and refers to
+ * it by a compact id.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef STRING_POOL_HPP_
+#define STRING_POOL_HPP_
+
+#include <cstddef> /// size_t
+#include <cstdint> /// uint32_t
+
+#include <atomic> /// atomic
+
+#include <deque> /// deque
+
+#include <string> /// string
+using std::string;
+
+#include <string_view> /// string_view
+using std::string_view;
+
+#include <unordered_map> /// unordered_map
+
+#include <vector> /// vector
+using std::vector;
+
+#include <shared_mutex> /// shared_mutex, shared_lock
+#include <mutex> /// unique_lock
+
+/**
+ * @brief Process-wide table of interned strings
+ *
+ * Each distinct string is stored once and identified by a 32-bit id. The text
+ * of an id never moves, so the views returned by resolve() remain valid until
+ * the id is reclaimed. Ids are only reclaimed by reclaim(), which a live input
+ * calls to bound the strings kept to the ones of the bar charts still in
+ * memory; a freed id is then reused for a later string. Every member function
+ * is safe to call from several threads.
+ *
+ * The views of the ids are kept in chunks that are only ever appended to,
+ * and each chunk is published with an atomic pointer before the id of its
+ * first text is returned, so resolve() takes no lock. Only intern(), size()
+ * and reclaim() lock the table.
+ */
+class StringPool {
+   public:
+   /**
+    * @brief Get the instance shared by the whole program
+    * @return Reference to the string pool
+    */
+   static StringPool& getInstance();
+
+   /**
+    * @brief Get the id of a string, adding it to the pool if needed
+    * @param text The string
+    * @return Id of the string
+    */
+   uint32_t intern(string_view text);
+
+   /**
+    * @brief Get the text of an id
+    * @param id Id returned by intern() and not reclaimed since
+    * @return View of the text, valid until the id is reclaimed
+    */
+   string_view resolve(uint32_t id) const;
+
+   /**
+    * @brief Get the number of distinct strings in the pool
+    * @return Number of strings, without the reclaimed ones
+    */
+   size_t size() const;
+
+   /**
+    * @brief Get the number of times strings were reclaimed
+    * @return Generation of the ids, which changes with each reclaim()
+    */
+   size_t getGeneration() const;
+
+   /**
+    * @brief Free the strings whose ids are not marked as live, so their ids
+    * can be reused
+    *
+    * No thread may hold an id that is not marked, nor intern a string
+    * whose id it has not stored where it was marked from yet.
+    *
+    * @param live Whether each id is still referred to, the ids past its
+    * end being freed too
+    * @return Number of strings left in the pool
+    */
+   size_t reclaim(vector<bool> const& live);
+
+   private:
+   /**
+    * @brief Construct an empty pool, holding only the empty string (id 0)
+    */
+   StringPool();
+
+   StringPool(StringPool const&) = delete;
+
+   StringPool& operator=(StringPool const&) = delete;
+
+   /**
+    * @brief Free the chunks of views
+    */
+   ~StringPool();
+
+   /**
+    * @brief Store a new text and publish its id, with the unique lock held
+    * @param text The string
+    * @return Id of the string
+    */
+   uint32_t add(string_view text);
+
+   static constexpr size_t CHUNK_BITS { 16 }; ///< Log2 of the ids of a chunk
+   static constexpr size_t CHUNK_SIZE {
+      size_t { 1 } << CHUNK_BITS
+   }; ///< Views held by each chunk
+   static constexpr size_t MAX_CHUNKS {
+      (size_t { UINT32_MAX } >> CHUNK_BITS) + 1
+   }; ///< Chunks needed to hold every 32-bit id
+
+   mutable std::shared_mutex pool_mutex; ///< Mutex guarding the table
+
+   std::deque<string> texts; ///< Text of each id, emptied when it is freed
+
+   std::atomic<string_view*> chunks[MAX_CHUNKS]
+     = {}; ///< View of the text of each id, in chunks that never move
+
+   std::atomic<uint32_t> count { 0 }; ///< Number of ids published
+
+   vector<uint32_t> free_ids; ///< Reclaimed ids, waiting to be reused
+
+   std::atomic<size_t> generation { 0 }; ///< Number of reclaim() calls
+
+   std::unordered_map<string_view, uint32_t>
+     ids; ///< Id of each text, keyed by views into texts
+};
+
+/**
+ * @brief Cache of the ids a single thread got from the StringPool
+ *
+ * A thread that interns the same few strings over and over, such as the
+ * categories and labels of every bar chart, finds them in its own cache and
+ * only goes to the shared pool, and its lock, for the strings it never saw.
+ * The cache empties itself once the pool reclaims strings. A cache must not
+ * be shared between threads.
+ */
+class StringCache {
+   public:
+   /**
+    * @brief Get the id of a string, adding it to the pool if needed
+    * @param text The string
+    * @return Id of the string
+    */
+   uint32_t intern(string_view text);
+
+   private:
+   std::unordered_map<string_view, uint32_t>
+     ids; ///< Id of each text seen, keyed by views into the pool
+   size_t generation { 0 }; ///< Generation of the pool the ids belong to
+};
+
+#endif /// STRING_POOL_HPP_
@@ -0,0 +1,155 @@
+/**
+ * @file fnumber.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of non-allocating number formatting functions.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "fnumber.hpp"
+
+#include <charconv> /// to_chars, chars_format
+#include <cmath> /// fabs, isfinite, pow
+#include <cstring> /// memmove
+
+namespace {
+   constexpr char SUFFIXES[] { 'K', 'M', 'B' }; ///< Letters of the scales
+
+   // Insert the separators of the thousands into the integer part of the
+   // number written at the start of a buffer
+   size_t separate(char* buffer, size_t size, size_t length, char separator) {
+      size_t const sign { buffer[0] == '-' ? size_t { 1 } : size_t { 0 } };
+      size_t end { sign };
+
+      while (end < length && buffer[end] >= '0' && buffer[end] <= '9') {
+         ++end;
+      }
+
+      size_t const digits { end - sign };
+
+      if (digits <= 3) {
+         return length;
+      }
+
+      size_t const separators { (digits - 1) / 3 };
+
+      if (length + separators > size) {
+         return 0;
+      }
+
+      // Move the decimal part, then the digits from right to left, putting a
+      // separator before every group of three
+      std::memmove(buffer + end + separators, buffer + end, length - end);
+
+      size_t read { end };
+      size_t write { end + separators };
+      size_t group { 0 };
+
+      while (read != write) {
+         if (group == 3) {
+            buffer[--write] = separator;
+            group = 0;
+         } else {
+            buffer[--write] = buffer[--read];
+            ++group;
+         }
+      }
+
+      return length + separators;
+   }
+}
+
+namespace fos {
+   // Write a number in fixed notation
+   size_t formatFixed(char* buffer, size_t size, long double value,
+     NumberFormat const& _format) {
+      size_t unit { 0 };
+
+      if (_format.suffix && std::isfinite(value)) {
+         // Scale up once more when rounding would write 1000 of a unit
+         long double const half { 0.5L
+           * std::pow(10.0L, -static_cast<long double>(_format.precision)) };
+
+         while (unit < sizeof(SUFFIXES) && std::fabs(value) >= 1000 - half) {
+            value /= 1000;
+            ++unit;
+         }
+      }
+
+      std::to_chars_result const result { std::to_chars(buffer,
+        buffer + size,
+        value,
+        std::chars_format::fixed,
+        _format.precision) };
+
+      if (result.ec != std::errc {}) {
+         return 0;
+      }
+
+      size_t length { static_cast<size_t>(result.ptr - buffer) };
+
+      if (_format.separator != '\0') {
+         length = separate(buffer, size, length, _format.separator);
+      }
+
+      if (unit != 0 && length != 0) {
+         if (length == size) {
+            return 0;
+         }
+
+         buffer[length++] = SUFFIXES[unit - 1];
+      }
+
+      return length;
+   }
+
+   // Write an integer
+   size_t formatInteger(char* buffer, size_t size, long long value,
+     NumberFormat const& _format) {
+      if (_format.suffix && (value >= 1000 || value <= -1000)) {
+         return formatFixed(
+           buffer, size, static_cast<long double>(value), _format);
+      }
+
+      std::to_chars_result const result { std::to_chars(
+        buffer, buffer + size, value) };
+
+      if (result.ec != std::errc {}) {
+         return 0;
+      }
+
+      size_t const length { static_cast<size_t>(result.ptr - buffer) };
+
+      if (_format.separator != '\0') {
+         return separate(buffer, size, length, _format.separator);
+      }
+
+      return length;
+   }
+
+   // Append a number in fixed notation to a string
+   void appendFixed(
+     std::string& output, long double value, NumberFormat const& _format) {
+      char buffer[NUMBER_CAPACITY];
+      size_t const length { formatFixed(
+        buffer, sizeof(buffer), value, _format) };
+
+      if (length != 0) {
+         output.append(buffer, length);
+         return;
+      }
+
+      // Huge values do not fit in the local buffer, grow a temporary one
+      std::string text(NUMBER_CAPACITY, '\0');
+      size_t written { 0 };
+
+      while (written == 0) {
+         text.resize(text.size() * 2);
+         written = formatFixed(text.data(), text.size(), value, _format);
+      }
+
+      output.append(text, 0, written);
+   }
+} // namespace fos
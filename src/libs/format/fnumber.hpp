@@ -0,0 +1,82 @@
+/**
+ * @file fnumber.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Definition of non-allocating number formatting functions.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * With the default format, these functions write the same text as printf
+ * with "%.2Lf" and std::to_string, but into a buffer of the caller, without
+ * streams, locales or allocations.
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef FNUMBER_HPP_
+#define FNUMBER_HPP_
+
+#include <cstddef> /// size_t
+
+#include <string> /// string
+
+/**
+ * @brief Formatted output string
+ */
+namespace fos {
+   ///< Definition of system constants >//
+   inline constexpr size_t NUMBER_CAPACITY {
+      64
+   }; ///< Bytes of a buffer that holds any usual number >//
+
+   /**
+    * @brief How a number is written
+    */
+   struct NumberFormat {
+      int precision { 2 }; ///< Digits after the decimal point
+      char separator { '\0' }; ///< Separator of the thousands ('\0': none)
+      bool suffix { false }; ///< Scale by K, M or B (thousand, million,
+                             ///< billion) and write the letter after it
+   };
+
+   /**
+    * @brief Write a number in fixed notation
+    *
+    * @param buffer Where to write the text
+    * @param size Bytes of the buffer
+    * @param value The number
+    * @param _format How the number is written (default: 2 decimal places)
+    * @return Bytes written, or 0 if the text does not fit in the buffer
+    */
+   size_t formatFixed(char* buffer, size_t size, long double value,
+     NumberFormat const& _format = {});
+
+   /**
+    * @brief Write an integer
+    *
+    * The precision of the format is only used when the integer is scaled by
+    * a suffix.
+    *
+    * @param buffer Where to write the text
+    * @param size Bytes of the buffer
+    * @param value The integer
+    * @param _format How the integer is written (default: its digits)
+    * @return Bytes written, or 0 if the text does not fit in the buffer
+    */
+   size_t formatInteger(char* buffer, size_t size, long long value,
+     NumberFormat const& _format = {});
+
+   /**
+    * @brief Append a number in fixed notation to a string
+    *
+    * Numbers too long for NUMBER_CAPACITY bytes, such as huge long doubles,
+    * are written through a temporary buffer.
+    *
+    * @param output String to append to
+    * @param value The number
+    * @param _format How the number is written (default: 2 decimal places)
+    */
+   void appendFixed(std::string& output, long double value,
+     NumberFormat const& _format = {});
+} // namespace fos
+
+#endif // FNUMBER_HPP_
@@ -9,34 +9,77 @@
  *
  */
 #include "fstring.hpp"
-#include <iostream>
+
+#include <algorithm> /// min
+#include <cstdint> /// uint16_t, uint64_t
+#include <stdexcept> /// invalid_argument
+#include <unordered_map> /// unordered_map
+#include <utility> /// move
+
+namespace {
+   // Get an element as the text it is printed as
+   template <typename T>
+   std::string elementOf(T element) {
+      std::ostringstream text;
+      text << element;
+
+      return text.str();
+   }
+
+   std::string elementOf(char element) {
+      return std::string(1, element);
+   }
+
+   std::string elementOf(char const* element) {
+      return element;
+   }
+
+   std::string elementOf(std::string element) {
+      return element;
+   }
+
+   // Remove the line breaks appended to the end of a string after a position
+   void trimNewLines(std::string& output, size_t start) {
+      while (output.size() > start && output.back() == '\n') {
+         output.pop_back();
+      }
+   }
+}
 
 namespace fos {
    // Removes target characters from the left of the string
    std::string leftTrim(std::string const& str, std::string _target) {
-      std::string trimmed { str };
-
-      trimmed.erase(0, trimmed.find_first_not_of(_target));
-
-      return trimmed;
+      return std::string(leftTrimView(str, _target));
    }
 
    // Removes target characters from the right of the string
    std::string rightTrim(std::string const& str, std::string _target) {
-      std::string trimmed { str };
-
-      trimmed.erase(trimmed.find_last_not_of(_target) + 1);
-
-      return trimmed;
+      return std::string(rightTrimView(str, _target));
    }
 
    // Removes target characters from both ends of the string
    std::string trim(std::string const& str, std::string _target) {
-      std::string trimmed { str };
-      trimmed = leftTrim(trimmed);
-      trimmed = rightTrim(trimmed);
+      return std::string(trimView(str, _target));
+   }
+
+   // Views a string without the target characters to its left
+   std::string_view leftTrimView(
+     std::string_view str, std::string_view _target) {
+      size_t const first { str.find_first_not_of(_target) };
+
+      return first == std::string_view::npos ? str.substr(str.size())
+                                             : str.substr(first);
+   }
+
+   // Views a string without the target characters to its right
+   std::string_view rightTrimView(
+     std::string_view str, std::string_view _target) {
+      return str.substr(0, str.find_last_not_of(_target) + 1);
+   }
 
-      return trimmed;
+   // Views a string without the target characters at its ends
+   std::string_view trimView(std::string_view str, std::string_view _target) {
+      return rightTrimView(leftTrimView(str, _target), _target);
    }
 
    // Replaces the first occurrence of the target with the replacement string
@@ -55,99 +98,118 @@ namespace fos {
    // Replaces all occurrences of the target with the replacement string
    std::string replace(
      std::string const& str, std::string target, std::string _replace) {
-      std::string replaced { replaceFirst(str, target, _replace) };
-      std::string buffer;
+      std::string replaced;
+      replaced.reserve(str.size());
+      appendReplace(replaced, str, target, _replace);
 
-      while (replaced != buffer) {
-         buffer = replaced;
-         replaced = replaceFirst(replaced, target, _replace);
+      return replaced;
+   }
+
+   // Appends a string with all occurrences of the target replaced
+   void appendReplace(std::string& output, std::string_view str,
+     std::string_view target, std::string_view _replace) {
+      if (target.empty()) {
+         output.append(str);
+         return;
       }
 
-      return replaced;
+      size_t begin { 0 };
+      size_t found;
+
+      while ((found = str.find(target, begin)) != std::string_view::npos) {
+         output.append(str.substr(begin, found - begin));
+         output.append(_replace);
+         begin = found + target.size();
+      }
+
+      output.append(str.substr(begin));
    }
 
    // Retrieves a substring from a string
    std::string subString(std::string const& str, size_t end, size_t _init) {
-      std::ostringstream sub_string;
+      return std::string(subView(str, end, _init));
+   }
 
-      for (size_t index { _init }; index < end; ++index) {
-         sub_string << str[index];
+   // Views a substring of a string
+   std::string_view subView(std::string_view str, size_t end, size_t _init) {
+      if (_init >= end || _init >= str.size()) {
+         return str.substr(str.size());
       }
 
-      return sub_string.str();
+      return str.substr(_init, end - _init);
    }
 
    // Splits a string based on a delimiter and stores substrings in a vector
    std::vector<std::string> split(
      std::string const& str, std::string _delimiter) {
-      std::string divided { str };
-      std::vector<std::string> split_tokens;
+      std::vector<std::string_view> tokens;
+      split(str, tokens, _delimiter);
 
-      while (divided.find_first_not_of(_delimiter) != std::string::npos) {
-         divided.erase(0, divided.find_first_not_of(_delimiter));
+      return std::vector<std::string>(tokens.begin(), tokens.end());
+   }
 
-         if (divided.find_first_of(_delimiter) != std::string::npos) {
-            split_tokens.push_back(
-              subString(divided, divided.find_first_of(_delimiter)));
-            divided.erase(0, divided.find_first_of(_delimiter));
-         } else {
-            split_tokens.push_back(subString(divided, divided.length()));
-            divided.clear();
+   // Split a string view into views of its non-empty substrings
+   void split(std::string_view str, std::vector<std::string_view>& tokens,
+     std::string_view _delimiter) {
+      tokens.clear();
+
+      size_t begin { str.find_first_not_of(_delimiter) };
+
+      while (begin != std::string_view::npos) {
+         size_t const end { str.find_first_of(_delimiter, begin) };
+         tokens.push_back(str.substr(begin, end - begin));
+
+         if (end == std::string_view::npos) {
+            break;
          }
-      }
 
-      return split_tokens;
+         begin = str.find_first_not_of(_delimiter, end);
+      }
    }
 
    // Split a string into a vector of substrings using a specified delimiter
    std::vector<std::string> splitWithEmpty(
      std::string const& str, std::string _delimiter) {
-      std::string divided { str };
-      std::vector<std::string> split_tokens;
-
-      while (divided.find_first_of(_delimiter) != std::string::npos) {
-         size_t first_delimiter { divided.find_first_of(_delimiter) };
-         size_t second_delimiter { divided.find_first_of(
-           _delimiter, first_delimiter + 1) };
-         size_t text { divided.find_first_not_of(_delimiter) };
-
-         if (text < first_delimiter) {
-            split_tokens.push_back(subString(divided, first_delimiter));
-            divided.erase(0, first_delimiter);
-         } else if (second_delimiter != std::string::npos) {
-            split_tokens.push_back(
-              subString(divided, second_delimiter, first_delimiter + 1));
-            divided.erase(0, second_delimiter);
-         } else {
-            split_tokens.push_back(
-              subString(divided, divided.length(), first_delimiter + 1));
-            divided.erase();
-         }
-      }
+      std::vector<std::string_view> tokens;
+      splitWithEmpty(str, tokens, _delimiter);
 
-      if (!divided.empty()) {
-         split_tokens.push_back(divided);
-      }
-
-      return split_tokens;
+      return std::vector<std::string>(tokens.begin(), tokens.end());
    }
 
-   // Repeats an element a specified number of times
-   template <typename T>
-   std::string repeat(T element, size_t times, bool _max_width) {
-      std::ostringstream repeated;
+   // Split a string view into views using a specified delimiter
+   void splitWithEmpty(std::string_view str,
+     std::vector<std::string_view>& tokens, std::string_view _delimiter) {
+      tokens.clear();
 
-      for (size_t index { 0 }; index < times; ++index) {
-         repeated << element;
+      if (str.empty()) {
+         return;
       }
 
-      std::string repeated_str { repeated.str() };
+      // A delimiter at the very beginning does not open an empty token
+      size_t begin { _delimiter.find(str.front()) != std::string_view::npos
+          ? size_t { 1 }
+          : size_t { 0 } };
 
-      if (_max_width) {
-         repeated_str.resize(times);
+      while (true) {
+         size_t end { str.find_first_of(_delimiter, begin) };
+
+         if (end == std::string_view::npos) {
+            tokens.push_back(str.substr(begin));
+            break;
+         }
+
+         tokens.push_back(str.substr(begin, end - begin));
+         begin = end + 1;
       }
+   }
 
-      return repeated_str;
+   // Repeats an element a specified number of times
+   template <typename T>
+   std::string repeat(T element, size_t times, bool _max_width) {
+      std::string repeated;
+      appendRepeat(repeated, elementOf(element), times, _max_width);
+
+      return repeated;
    }
 
    template std::string repeat<char>(
@@ -162,56 +224,147 @@ namespace fos {
    template std::string repeat<double>(
      double element, size_t times, bool _max_width);
 
+   // Appends an element repeated a specified number of times
+   void appendRepeat(std::string& output, std::string_view element,
+     size_t times, bool _max_width) {
+      size_t const size { element.size() * times };
+      size_t const width { _max_width ? std::min(size, times) : size };
+      size_t const start { output.size() };
+
+      if (element.size() == 1) {
+         output.append(width, element.front());
+      } else if (width != 0) {
+         // Double the repetitions already written until the width is reached
+         output.append(element.substr(0, width));
+
+         while (output.size() - start < width) {
+            size_t const written { output.size() - start };
+            output.append(
+              output, start, std::min(written, width - written));
+         }
+      }
+
+      if (_max_width && width < times) {
+         // An element narrower than one character leaves the rest empty
+         output.append(times - width, '\0');
+      }
+   }
+
    // Wraps text to a specified width, with a specified delimiter
    std::string columnWrap(std::string& str, size_t size, std::string _delimiter,
      std::string _new_delimiter) {
-      std::ostringstream text;
-      std::string line;
-      std::vector<std::string> phrases { splitWithEmpty(str, "\n") };
+      std::string wrapped;
+      appendColumnWrap(wrapped, str, size, _delimiter, _new_delimiter);
 
-      for (std::string& phrase : phrases) {
-         std::string trimmed { trim(phrase) };
-         std::vector<std::string> words { split(trimmed, _delimiter) };
+      return wrapped;
+   }
 
-         if (words.empty()) {
-            text << '\n';
-         }
+   // Appends text wrapped to a specified width
+   void appendColumnWrap(std::string& output, std::string_view str,
+     size_t size, std::string_view _delimiter,
+     std::string_view _new_delimiter) {
+      size_t const start { output.size() };
+
+      if (str.empty()) {
+         return;
+      }
 
-         for (std::string& word : words) {
-            if ((line + word).length() >= size) {
-               text << line << '\n';
+      // The line being filled is written in place, from line_start
+      size_t line_start { output.size() };
 
-               while (word.length() >= size) {
-                  text << subString(word, size) << '\n';
-                  word.erase(0, size);
+      // Phrases are split as splitWithEmpty does with a line break
+      size_t begin { str.front() == '\n' ? size_t { 1 } : size_t { 0 } };
+
+      while (true) {
+         size_t const end { str.find('\n', begin) };
+         std::string_view const trimmed { trimView(
+           str.substr(begin, end - begin)) };
+         size_t position { trimmed.find_first_not_of(_delimiter) };
+
+         if (position == std::string_view::npos) {
+            output.push_back('\n');
+            line_start = output.size();
+         }
+
+         while (position != std::string_view::npos) {
+            size_t const word_end { trimmed.find_first_of(
+              _delimiter, position) };
+            std::string_view word { trimmed.substr(
+              position, word_end - position) };
+            position = word_end == std::string_view::npos
+              ? word_end
+              : trimmed.find_first_not_of(_delimiter, word_end);
+
+            if (output.size() - line_start + word.size() >= size) {
+               output.push_back('\n');
+
+               while (word.size() >= size) {
+                  output.append(word.substr(0, size));
+                  output.push_back('\n');
+                  word.remove_prefix(size);
                }
 
-               line.clear();
+               line_start = output.size();
             }
 
-            line += word;
-            line += &word != &words.back() ? _new_delimiter : "";
+            output.append(word);
+
+            if (position != std::string_view::npos) {
+               output.append(_new_delimiter);
+            }
+         }
+
+         if (output.size() != line_start) {
+            output.push_back('\n');
+            line_start = output.size();
          }
 
-         if (!line.empty()) {
-            text << line << '\n';
-            line.clear();
+         if (end == std::string_view::npos) {
+            break;
          }
+
+         begin = end + 1;
       }
 
-      text.str(rightTrim(text.str(), "\n"));
-      return text.str();
+      trimNewLines(output, start);
    }
 
    // Justifies text within a specified width and alignment
    template <typename T>
    std::string alignment(std::string& str, size_t size, align _align,
      T _element, bool _dynamic_size, bool _right_space) {
-      std::ostringstream justified;
-      std::vector<std::string> phrases { splitWithEmpty(str, "\n") };
+      std::string justified;
+      appendAlignment(justified,
+        str,
+        size,
+        _align,
+        elementOf(_element),
+        _dynamic_size,
+        _right_space);
+
+      return justified;
+   }
 
-      std::string longest_line { trim(findLongestLine(str)) };
-      size_t max_size { longest_line.length() };
+   template std::string alignment<char>(std::string& str, size_t size,
+     align _align, char _element = ' ', bool _dynamic_size, bool _right_space);
+   template std::string alignment<char const*>(std::string& str, size_t size,
+     align _align, char const* _element = " ", bool _dynamic_size,
+     bool _right_space);
+   template std::string alignment<std::string>(std::string& str, size_t size,
+     align _align, std::string _element = " ", bool _dynamic_size,
+     bool _right_space);
+   template std::string alignment<int>(std::string& str, size_t size,
+     align _align, int _element = 0, bool _dynamic_size, bool _right_space);
+   template std::string alignment<float>(std::string& str, size_t size,
+     align _align, float _element = 0, bool _dynamic_size, bool _right_space);
+   template std::string alignment<double>(std::string& str, size_t size,
+     align _align, double _element = 0, bool _dynamic_size, bool _right_space);
+
+   // Appends text justified within a specified width and alignment
+   void appendAlignment(std::string& output, std::string_view str,
+     size_t size, align _align, std::string_view _element, bool _dynamic_size,
+     bool _right_space) {
+      size_t const max_size { trimView(findLongestLineView(str)).size() };
 
       if (!_dynamic_size && max_size > size) {
          throw std::invalid_argument(
@@ -220,78 +373,92 @@ namespace fos {
          size = max_size;
       }
 
-      for (std::string& phrase : phrases) {
-         std::string trimmed { fos::trim(phrase) };
+      size_t const start { output.size() };
+
+      if (str.empty()) {
+         return;
+      }
+
+      // Phrases are split as splitWithEmpty does with a line break
+      size_t begin { str.front() == '\n' ? size_t { 1 } : size_t { 0 } };
+
+      while (true) {
+         size_t const end { str.find('\n', begin) };
+         std::string_view const trimmed { trimView(
+           str.substr(begin, end - begin)) };
          size_t free_space { size - trimmed.length() };
          bool is_even { free_space % 2 == 0 };
 
          if (_align == align::left) {
-            justified << trimmed;
+            output.append(trimmed);
          } else if (_align == align::center) {
-            justified << repeat(_element, free_space / 2, true) << trimmed;
+            appendRepeat(output, _element, free_space / 2, true);
+            output.append(trimmed);
             free_space /= 2;
          } else if (_align == align::right) {
-            justified << repeat(_element, free_space, true) << trimmed;
+            appendRepeat(output, _element, free_space, true);
+            output.append(trimmed);
          } else if (_align == align::justify) {
-            std::vector<std::string> words { fos::split(trimmed, " ") };
+            size_t words { 0 };
 
-            if (words.size() == 0) {
-               justified << fos::repeat(_element, free_space, true);
-            } else if (words.size() == 1) {
-               justified << words.front()
-                         << fos::repeat(_element, free_space, true);
+            for (size_t position { trimmed.find_first_not_of(' ') };
+                 position != std::string_view::npos;
+                 position = trimmed.find_first_not_of(
+                   ' ', trimmed.find(' ', position))) {
+               ++words;
+            }
+
+            if (words == 0) {
+               appendRepeat(output, _element, free_space, true);
+            } else if (words == 1) {
+               output.append(trimView(trimmed, " "));
+               appendRepeat(output, _element, free_space, true);
             } else {
-               size_t spaces { words.size() + free_space - 1 };
-               size_t spaces_per_word { spaces / (words.size() - 1) };
-               size_t spaces_truncated { spaces % (words.size() - 1) };
+               size_t spaces { words + free_space - 1 };
+               size_t spaces_per_word { spaces / (words - 1) };
+               size_t spaces_truncated { spaces % (words - 1) };
+               size_t position { trimmed.find_first_not_of(' ') };
+
+               for (size_t word { 0 }; word != words; ++word) {
+                  size_t const word_end { trimmed.find(' ', position) };
+                  output.append(
+                    trimmed.substr(position, word_end - position));
 
-               for (std::string& word : words) {
-                  if (&word == &words.back()) {
+                  if (word + 1 == words) {
                      break;
                   }
 
-                  justified << word
-                            << fos::repeat(_element, spaces_per_word, true);
+                  appendRepeat(output, _element, spaces_per_word, true);
 
                   if (spaces_truncated != 0) {
-                     justified << repeat(_element, 1, true);
+                     appendRepeat(output, _element, 1, true);
                      --spaces_truncated;
                   }
-               }
 
-               justified << words.back();
+                  position = trimmed.find_first_not_of(' ', word_end);
+               }
             }
          }
 
          if (_right_space && _align == align::left && !trimmed.empty()) {
-            justified << repeat(_element, free_space, true);
+            appendRepeat(output, _element, free_space, true);
          } else if (_right_space && _align == align::center) {
             free_space += !is_even ? 1 : 0;
-            justified << repeat(_element, free_space, true);
+            appendRepeat(output, _element, free_space, true);
+         }
+
+         output.push_back('\n');
+
+         if (end == std::string_view::npos) {
+            break;
          }
 
-         justified << '\n';
+         begin = end + 1;
       }
 
-      justified.str(rightTrim(justified.str(), "\n"));
-      return justified.str();
+      trimNewLines(output, start);
    }
 
-   template std::string alignment<char>(std::string& str, size_t size,
-     align _align, char _element = ' ', bool _dynamic_size, bool _right_space);
-   template std::string alignment<char const*>(std::string& str, size_t size,
-     align _align, char const* _element = " ", bool _dynamic_size,
-     bool _right_space);
-   template std::string alignment<std::string>(std::string& str, size_t size,
-     align _align, std::string _element = " ", bool _dynamic_size,
-     bool _right_space);
-   template std::string alignment<int>(std::string& str, size_t size,
-     align _align, int _element = 0, bool _dynamic_size, bool _right_space);
-   template std::string alignment<float>(std::string& str, size_t size,
-     align _align, float _element = 0, bool _dynamic_size, bool _right_space);
-   template std::string alignment<double>(std::string& str, size_t size,
-     align _align, double _element = 0, bool _dynamic_size, bool _right_space);
-
    // Concatenates a collection of strings with a specified separator
    template <typename T>
    std::string concat(T* init, T* end, std::string _separator) {
@@ -321,59 +488,114 @@ namespace fos {
 
    // Reverses the characters in a string
    std::string reverse(std::string const& str) {
-      std::ostringstream reversed;
-
-      for (size_t index { str.length() }; index != 0; --index) {
-         reversed << str[index - 1];
-      }
-
-      return reversed.str();
+      return std::string(str.rbegin(), str.rend());
    }
 
    // Counts the number of lines in a string
    size_t countLines(std::string const& str) {
-      return (split(str, "\n")).size();
+      std::vector<std::string_view> lines;
+      split(str, lines, "\n");
+
+      return lines.size();
    }
 
    // Applies text styling to a string.
    std::string setStyle(std::string const& str, short const _color,
      short const _background, short const _style) {
-      std::ostringstream text;
-      std::ostringstream styled_escape;
+      std::string styled;
+      appendStyle(styled, str, _color, _background, _style);
 
-      if (_style != style::none) {
-         styled_escape << "\33[" << _style << 'm';
-      }
-      if (_color != foreground::none) {
-         styled_escape << "\33[" << _color << 'm';
-      }
-      if (_background != background::none) {
-         styled_escape << "\33[" << _background << 'm';
+      return styled;
+   }
+
+   // Appends a string with a text style applied to it
+   void appendStyle(std::string& output, std::string_view str,
+     short const _color, short const _background, short const _style) {
+      std::string_view const opening { styleOpening(
+        _color, _background, _style) };
+      std::string_view const closing { styleClosing() };
+
+      output.reserve(output.size() + opening.size() + str.size()
+        + closing.size());
+      output.append(opening);
+      output.append(str);
+      output.append(closing);
+   }
+
+   // Gets the escape sequences that open a text style
+   std::string_view styleOpening(
+     short const _color, short const _background, short const _style) {
+      // Each render thread keeps its own sequences, so none waits for a lock
+      thread_local std::unordered_map<uint64_t, std::string> openings;
+
+      uint64_t const key { static_cast<uint64_t>(
+                             static_cast<uint16_t>(_color))
+        | static_cast<uint64_t>(static_cast<uint16_t>(_background)) << 16
+        | static_cast<uint64_t>(static_cast<uint16_t>(_style)) << 32 };
+      auto found { openings.find(key) };
+
+      if (found == openings.end()) {
+         std::string opening;
+
+         if (_style != style::none) {
+            opening += "\33[" + std::to_string(_style) + 'm';
+         }
+         if (_color != foreground::none) {
+            opening += "\33[" + std::to_string(_color) + 'm';
+         }
+         if (_background != background::none) {
+            opening += "\33[" + std::to_string(_background) + 'm';
+         }
+
+         found = openings.emplace(key, std::move(opening)).first;
       }
 
-      std::ostringstream regular_escape;
-      regular_escape << "\33[" << style::regular << 'm';
+      return found->second;
+   }
 
-      text << styled_escape.str() << str << regular_escape.str();
+   // Gets the escape sequence that closes any text style
+   std::string_view styleClosing() {
+      static std::string const closing { "\33["
+        + std::to_string(style::regular) + "m" };
 
-      return text.str();
+      return closing;
+   }
+
+   // Gets a bar of full blocks
+   std::string_view blockBar(size_t size) {
+      static std::string const blocks { repeat("\u2588", BLOCK_BAR_LENGTH) };
+
+      size_t const block_size { blocks.size() / BLOCK_BAR_LENGTH };
+
+      return std::string_view(blocks).substr(
+        0, std::min(size, BLOCK_BAR_LENGTH) * block_size);
    }
 
    // Finds the longest line of text
    std::string findLongestLine(std::string const& str) {
-      std::vector<std::string> lines { splitWithEmpty(str, "\n") };
-      std::string max_line { lines.front() };
-      std::string max_line_trimmed { trim(max_line) };
+      return std::string(findLongestLineView(str));
+   }
 
-      for (std::string line : lines) {
-         std::string trimmed { trim(line) };
-         if (max_line.size() < line.size()) {
-            max_line = line;
-            max_line_trimmed = trim(line);
-         } else if (max_line.size() == line.size()
-           && trimmed.size() > max_line_trimmed.size()) {
+   // Views the longest line of text
+   std::string_view findLongestLineView(std::string_view str) {
+      std::vector<std::string_view> lines;
+      splitWithEmpty(str, lines, "\n");
+
+      if (lines.empty()) {
+         return str;
+      }
+
+      std::string_view max_line { lines.front() };
+      std::string_view max_line_trimmed { trimView(max_line) };
+
+      for (std::string_view line : lines) {
+         std::string_view const trimmed { trimView(line) };
+
+         if (max_line.size() < line.size()
+           || (max_line.size() == line.size()
+             && trimmed.size() > max_line_trimmed.size())) {
             max_line = line;
-            max_line_trimmed = trim(line);
+            max_line_trimmed = trimmed;
          }
       }
 
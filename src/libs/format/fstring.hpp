@@ -10,6 +10,7 @@
 
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 #ifndef FSTRING_HPP_
@@ -22,6 +23,11 @@ namespace fos {
 
 #include "style.hpp"
 
+   ///< Definition of system constants >//
+   inline constexpr size_t BLOCK_BAR_LENGTH {
+      256
+   }; ///< Blocks of the longest bar viewed at once >//
+
    /**
     * @brief Text alignment
     */
@@ -62,6 +68,36 @@ namespace fos {
    std::string trim(
      std::string const& str, std::string _target = " \t\n\r\f\v");
 
+   /**
+    * @brief View a string without the target characters to its left
+    *
+    * @param str String to trim
+    * @param _target Target wanted (default: " \t\n\r\f\v")
+    * @return View into str
+    */
+   std::string_view leftTrimView(
+     std::string_view str, std::string_view _target = " \t\n\r\f\v");
+
+   /**
+    * @brief View a string without the target characters to its right
+    *
+    * @param str String to trim
+    * @param _target Target wanted (default: " \t\n\r\f\v")
+    * @return View into str
+    */
+   std::string_view rightTrimView(
+     std::string_view str, std::string_view _target = " \t\n\r\f\v");
+
+   /**
+    * @brief View a string without the target characters at its ends
+    *
+    * @param str String to trim
+    * @param _target Target wanted (default: " \t\n\r\f\v")
+    * @return View into str
+    */
+   std::string_view trimView(
+     std::string_view str, std::string_view _target = " \t\n\r\f\v");
+
    /**
     * @brief Replace the first occurrence of the target
     *
@@ -84,6 +120,20 @@ namespace fos {
    std::string replace(
      std::string const& str, std::string target, std::string _replace = "");
 
+   /**
+    * @brief Append a string with all occurrences of the target replaced
+    *
+    * The string is scanned once, so the replacements are not searched for
+    * the target again.
+    *
+    * @param output String that receives the result
+    * @param str String to replace
+    * @param target Target wanted (nothing is replaced if empty)
+    * @param _replace Replacement text (default: "")
+    */
+   void appendReplace(std::string& output, std::string_view str,
+     std::string_view target, std::string_view _replace = "");
+
    /**
     * @brief Get a substring
     *
@@ -95,6 +145,17 @@ namespace fos {
     */
    std::string subString(std::string const& str, size_t end, size_t _init = 0);
 
+   /**
+    * @brief View a substring
+    *
+    * @param str Full string
+    * @param end Ending position of the substring (open interval)
+    * @param _init Starting position of the substring (closed interval, default:
+    * 0)
+    * @return View into str (empty if _init is not before end)
+    */
+   std::string_view subView(std::string_view str, size_t end, size_t _init = 0);
+
    /**
     * @brief Split a string based on a delimiter and store all substrings in a
     * vector
@@ -105,6 +166,21 @@ namespace fos {
     */
    std::vector<std::string> split(
      std::string const& str, std::string _delimiter = " ");
+
+   /**
+    * @brief Split a string view into views of its non-empty substrings
+    *
+    * This overload follows the same rules as split, but the resulting
+    * substrings are views into the input. The vector is cleared before the
+    * split, which allows reusing its capacity across calls.
+    *
+    * @param str The input view to be split
+    * @param tokens Vector that receives the resulting views
+    * @param _delimiter The delimiters used to split the view (default is " ")
+    */
+   void split(std::string_view str, std::vector<std::string_view>& tokens,
+     std::string_view _delimiter = " ");
+
    /**
     * @brief Split a string into a vector of substrings using a specified
     * delimiter.
@@ -132,6 +208,22 @@ namespace fos {
    std::vector<std::string> splitWithEmpty(
      std::string const& str, std::string _delimiter = " ");
 
+   /**
+    * @brief Split a string view into views of its substrings, preserving
+    * empty substrings between consecutive delimiters
+    *
+    * This overload follows the same rules as splitWithEmpty, but the
+    * resulting substrings are views into the input, so no characters are
+    * copied. The vector is cleared before the split, which allows reusing its
+    * capacity across calls.
+    *
+    * @param str The input view to be split
+    * @param tokens Vector that receives the resulting views
+    * @param _delimiter The delimiters used to split the view (default is " ")
+    */
+   void splitWithEmpty(std::string_view str,
+     std::vector<std::string_view>& tokens, std::string_view _delimiter = " ");
+
    /**
     * @brief Repeat a given element a specified number of times
     *
@@ -149,6 +241,18 @@ namespace fos {
    template <typename T>
    std::string repeat(T element, size_t times = 1, bool _max_width = false);
 
+   /**
+    * @brief Append an element repeated a specified number of times
+    *
+    * @param output String that receives the repetitions
+    * @param element Element to be repeated
+    * @param times Number of times to repeat (default: 1)
+    * @param _max_width If true, "times" is the width of the repetitions
+    * instead (default: false)
+    */
+   void appendRepeat(std::string& output, std::string_view element,
+     size_t times = 1, bool _max_width = false);
+
    /**
     * @brief Wrap text to fit within a maximum width while preserving word
     * boundaries
@@ -163,6 +267,21 @@ namespace fos {
    std::string columnWrap(std::string& str, size_t size,
      std::string _delimiter = " ", std::string _new_delimiter = " ");
 
+   /**
+    * @brief Append text wrapped to fit within a maximum width while
+    * preserving word boundaries, as columnWrap
+    *
+    * @param output String that receives the wrapped text
+    * @param str Input text to be wrapped
+    * @param size Maximum width for the wrapped text
+    * @param _delimiter Delimiter for word boundaries (default: " ")
+    * @param _new_delimiter Delimiter to replace the original delimiter in the
+    * wrapped text (default: " ")
+    */
+   void appendColumnWrap(std::string& output, std::string_view str,
+     size_t size, std::string_view _delimiter = " ",
+     std::string_view _new_delimiter = " ");
+
    /**
     * @brief Justify a string based on a specified size and alignment
     *
@@ -186,6 +305,24 @@ namespace fos {
      align _align = align::left, T _element = ' ', bool _dynamic_size = false,
      bool _right_space = false);
 
+   /**
+    * @brief Append a string justified based on a specified size and
+    * alignment, as alignment
+    *
+    * @param output String that receives the justified string
+    * @param str Input string to be justified
+    * @param size Desired size for justification
+    * @param _align Alignment (left, right, or center) (default: align::left)
+    * @param _element Element to pad the string with (default: " ")
+    * @param _dynamic_size If true, the size is automatically set to match the
+    * widest line (default: false)
+    * @param _right_space If true, adds elements to the right until reaching the
+    * specified size (default: false)
+    */
+   void appendAlignment(std::string& output, std::string_view str,
+     size_t size, align _align = align::left, std::string_view _element = " ",
+     bool _dynamic_size = false, bool _right_space = false);
+
    /**
     * @brief Concatenate a collection of strings from init (inclusive) to end
     * (exclusive) with a separator between them
@@ -228,6 +365,52 @@ namespace fos {
      short const _background = background::none,
      short const _style = style::none);
 
+   /**
+    * @brief Append a string with a text style applied to it
+    *
+    * @param output String to append to
+    * @param str Input string
+    * @param _color Text color (default: foreground::none)
+    * @param _background Background color (default: background::none)
+    * @param _style Text style (default: style::none)
+    */
+   void appendStyle(std::string& output, std::string_view str,
+     short const _color = foreground::none,
+     short const _background = background::none,
+     short const _style = style::none);
+
+   /**
+    * @brief Get the escape sequences that open a text style
+    *
+    * The sequences of each combination are built the first time a thread
+    * asks for it and kept for the rest of the run, so a style is only
+    * looked up afterwards.
+    *
+    * @param _color Text color (default: foreground::none)
+    * @param _background Background color (default: background::none)
+    * @param _style Text style (default: style::none)
+    * @return View of the sequences, valid until the thread ends
+    */
+   std::string_view styleOpening(short const _color = foreground::none,
+     short const _background = background::none,
+     short const _style = style::none);
+
+   /**
+    * @brief Get the escape sequence that closes any text style
+    *
+    * @return View of the sequence
+    */
+   std::string_view styleClosing();
+
+   /**
+    * @brief Get a bar of full blocks (U+2588), sliced from a table of
+    * BLOCK_BAR_LENGTH blocks built once
+    *
+    * @param size Blocks of the bar, at most BLOCK_BAR_LENGTH
+    * @return View of the bar (longer bars are cut to BLOCK_BAR_LENGTH)
+    */
+   std::string_view blockBar(size_t size);
+
    /**
     * @brief Finds the longest line of text
     *
@@ -236,6 +419,14 @@ namespace fos {
     */
    std::string findLongestLine(std::string const& str);
 
+   /**
+    * @brief View the longest line of text
+    *
+    * @param str Input string
+    * @return View into str (empty if str is empty)
+    */
+   std::string_view findLongestLineView(std::string_view str);
+
    /**
     * @brief Complete each line of a string with a specified element
     *
@@ -0,0 +1,157 @@
+/**
+ * @file parsing.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of non-throwing numeric parsing functions.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "parsing.hpp"
+
+#include <cfloat> /// LDBL_MIN
+#include <charconv> /// from_chars, chars_format
+#include <climits> /// INT_MAX, INT_MIN
+#include <cmath> /// fabs
+
+namespace prs {
+   // Check if a character is whitespace in the "C" locale
+   static bool isSpace(char character) {
+      return character == ' ' || (character >= '\t' && character <= '\r');
+   }
+
+   // Check if a character is a hexadecimal digit
+   static bool isHexDigit(char character) {
+      return (character >= '0' && character <= '9')
+        || (character >= 'a' && character <= 'f')
+        || (character >= 'A' && character <= 'F');
+   }
+
+   // Skip the whitespace and the sign at the start of a string
+   static size_t skipPrefix(std::string_view str, bool& negative) {
+      size_t index { 0 };
+
+      while (index < str.size() && isSpace(str[index])) {
+         ++index;
+      }
+
+      negative = false;
+
+      if (index < str.size() && (str[index] == '+' || str[index] == '-')) {
+         negative = str[index] == '-';
+         ++index;
+      }
+
+      return index;
+   }
+
+   // Parse a base 10 integer at the start of a string
+   ParseStatus parseInteger(
+     std::string_view str, int& value, size_t& position) {
+      bool negative;
+      size_t index { skipPrefix(str, negative) };
+      size_t const digits { index };
+      long long magnitude { 0 };
+      bool overflow { false };
+
+      while (index < str.size() && str[index] >= '0' && str[index] <= '9') {
+         if (!overflow) {
+            magnitude = magnitude * 10 + (str[index] - '0');
+            overflow = magnitude > static_cast<long long>(INT_MAX) + 1;
+         }
+
+         ++index;
+      }
+
+      if (index == digits) {
+         return PARSE_INVALID;
+      }
+
+      if (overflow || (!negative && magnitude > INT_MAX)) {
+         return PARSE_OUT_OF_RANGE;
+      }
+
+      value = static_cast<int>(negative ? -magnitude : magnitude);
+      position = index;
+
+      return PARSE_OK;
+   }
+
+   // Parse a floating point number at the start of a string
+   ParseStatus parseLongDouble(std::string_view str, long double& value) {
+      bool negative;
+      size_t index { skipPrefix(str, negative) };
+
+      if (index < str.size() && (str[index] == '+' || str[index] == '-')) {
+         return PARSE_INVALID;
+      }
+
+      char const* first { str.data() + index };
+      char const* last { str.data() + str.size() };
+      long double parsed { 0 };
+      std::from_chars_result result;
+
+      if (last - first >= 2 && first[0] == '0'
+        && (first[1] == 'x' || first[1] == 'X')) {
+         char const* digits { first + 2 };
+         bool has_digits { digits != last
+           && (isHexDigit(*digits)
+             || (*digits == '.' && digits + 1 != last
+               && isHexDigit(digits[1]))) };
+
+         if (has_digits) {
+            result = std::from_chars(
+              digits, last, parsed, std::chars_format::hex);
+         } else {
+            // Only the leading zero is a number
+            result.ec = std::errc();
+         }
+      } else {
+         result = std::from_chars(first, last, parsed);
+      }
+
+      if (result.ec == std::errc::invalid_argument) {
+         return PARSE_INVALID;
+      }
+
+      if (result.ec == std::errc::result_out_of_range
+        || (parsed != 0 && std::fabs(parsed) < LDBL_MIN)) {
+         return PARSE_OUT_OF_RANGE;
+      }
+
+      value = negative ? -parsed : parsed;
+
+      return PARSE_OK;
+   }
+
+   // Check if a string holds only an integer
+   bool isInteger(std::string_view str, int& value) {
+      size_t position;
+      int parsed;
+
+      if (parseInteger(str, parsed, position) != PARSE_OK) {
+         return false;
+      }
+
+      // Compare with the length of the trimmed string, as std::stoi users do
+      size_t first { 0 };
+      size_t last { str.size() };
+
+      while (first < last && isSpace(str[first])) {
+         ++first;
+      }
+
+      while (last > first && isSpace(str[last - 1])) {
+         --last;
+      }
+
+      if (position != last - first) {
+         return false;
+      }
+
+      value = parsed;
+
+      return true;
+   }
+} // namespace prs
@@ -0,0 +1,75 @@
+/**
+ * @file parsing.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Definition of non-throwing numeric parsing functions.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * These functions accept the same text as std::stoi and std::stold and yield
+ * the same values, but report failures through a status code instead of
+ * throwing exceptions, so they are cheap on malformed input.
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef PARSING_HPP_
+#define PARSING_HPP_
+
+#include <string_view>
+
+/**
+ * @brief Parsing namespace
+ */
+namespace prs {
+   /**
+    * @brief Result of a parse
+    */
+   enum ParseStatus {
+      PARSE_OK, ///< The text was converted
+      PARSE_INVALID, ///< The text does not start with a number
+      PARSE_OUT_OF_RANGE, ///< The number does not fit in the type
+   };
+
+   /**
+    * @brief Parse a base 10 integer at the start of a string, like std::stoi
+    *
+    * Leading whitespace and a sign are accepted. The parse stops at the first
+    * character that is not a digit.
+    *
+    * @param str Text to parse
+    * @param value Receives the integer (unchanged unless PARSE_OK)
+    * @param position Receives the number of characters used (unchanged
+    * unless PARSE_OK)
+    * @return Status of the parse
+    */
+   ParseStatus parseInteger(
+     std::string_view str, int& value, size_t& position);
+
+   /**
+    * @brief Parse a floating point number at the start of a string, like
+    * std::stold
+    *
+    * Leading whitespace, a sign, decimal and hexadecimal notations, infinity
+    * and NaN are accepted. The parse stops at the first character that does
+    * not belong to the number. Values too small or too large to be
+    * represented without loss of range report PARSE_OUT_OF_RANGE, as
+    * std::stold would throw std::out_of_range for them.
+    *
+    * @param str Text to parse
+    * @param value Receives the number (unchanged unless PARSE_OK)
+    * @return Status of the parse
+    */
+   ParseStatus parseLongDouble(std::string_view str, long double& value);
+
+   /**
+    * @brief Check if a string holds only an integer, apart from surrounding
+    * whitespace
+    *
+    * @param str Text to check
+    * @param value Receives the integer (unchanged unless it returns true)
+    * @return true if the whole text is an integer, false otherwise
+    */
+   bool isInteger(std::string_view str, int& value);
+} // namespace prs
+
+#endif // PARSING_HPP_
@@ -0,0 +1,190 @@
+/**
+ * @file profiler.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the Profiler class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "profiler.hpp"
+
+#include <algorithm> /// min
+#include <cstdio> /// snprintf
+
+namespace {
+   ///< Name of each phase in the report >//
+   constexpr char const* PHASE_NAMES[PHASE_COUNT] { "configs",
+      "read",
+      "parse block",
+      "split",
+      "parse",
+      "categories",
+      "frame build",
+      "sort",
+      "Database::draw",
+      "BarChart::draw",
+      "Bar::draw",
+      "write",
+      "sleep" };
+
+   ///< Category of each phase in the trace, none for the phases too fine to
+   ///< be traced, which happen once for each line or bar >//
+   constexpr char const* PHASE_TRACE_CATEGORIES[PHASE_COUNT] { "config",
+      "ingest",
+      "ingest",
+      nullptr,
+      nullptr,
+      nullptr,
+      "ingest",
+      "render",
+      "render",
+      "render",
+      nullptr,
+      "output",
+      "pacing" };
+
+   // Get the bucket of the histogram that holds a duration
+   size_t bucketOf(uint64_t nanoseconds) {
+      if (nanoseconds < PROFILE_SUB_BUCKETS) {
+         return nanoseconds;
+      }
+
+      // The power of two, then the sixteenth of it below the duration
+      size_t exponent { 0 };
+
+      while ((nanoseconds >> exponent) >= 2 * PROFILE_SUB_BUCKETS) {
+         ++exponent;
+      }
+
+      return (exponent + 1) * PROFILE_SUB_BUCKETS
+        + ((nanoseconds >> exponent) - PROFILE_SUB_BUCKETS);
+   }
+
+   // Get the middle of the durations held by a bucket of the histogram
+   uint64_t valueOf(size_t bucket) {
+      if (bucket < PROFILE_SUB_BUCKETS) {
+         return bucket;
+      }
+
+      size_t const exponent { bucket / PROFILE_SUB_BUCKETS - 1 };
+      uint64_t const low { (PROFILE_SUB_BUCKETS + bucket % PROFILE_SUB_BUCKETS)
+        << exponent };
+
+      return low + ((uint64_t { 1 } << exponent) >> 1);
+   }
+}
+
+// The phases are not measured until asked for
+std::atomic<bool> Profiler::enabled { false };
+
+// Get the single instance of Profiler
+Profiler& Profiler::getInstance() {
+   // Initialized once, even when the first calls come from several threads
+   static Profiler instance;
+   return instance;
+}
+
+// Start measuring the phases
+void Profiler::enable() {
+   enabled.store(true, std::memory_order_relaxed);
+}
+
+// Record a measure of a phase
+void Profiler::record(ProfilePhase phase,
+  std::chrono::steady_clock::time_point start,
+  std::chrono::steady_clock::time_point end) {
+   if (Tracer::isEnabled() && PHASE_TRACE_CATEGORIES[phase] != nullptr) {
+      Tracer::getInstance().record(
+        PHASE_NAMES[phase], PHASE_TRACE_CATEGORIES[phase], start, end);
+   }
+
+   if (!isEnabled()) {
+      return;
+   }
+
+   uint64_t const nanoseconds { static_cast<uint64_t>(
+     std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+       .count()) };
+   Samples& samples { getThreadSamples().phases[phase] };
+
+   ++samples.count;
+   samples.total += nanoseconds;
+   samples.max = std::max(samples.max, nanoseconds);
+   ++samples.buckets[bucketOf(nanoseconds)];
+}
+
+// Get a table with the measures of each phase
+std::string Profiler::getReport() const {
+   std::lock_guard<std::mutex> lock { threads_mutex };
+
+   std::string report { ">>> Phase               count     total ms     "
+                        "mean us      p50 us      p99 us      max us\n" };
+   char buffer[160];
+
+   for (size_t phase { 0 }; phase != PHASE_COUNT; ++phase) {
+      // Merge the durations of every thread
+      Samples merged;
+
+      for (std::unique_ptr<ThreadSamples> const& thread : threads) {
+         Samples const& samples { thread->phases[phase] };
+         merged.count += samples.count;
+         merged.total += samples.total;
+         merged.max = std::max(merged.max, samples.max);
+
+         for (size_t bucket { 0 }; bucket != PROFILE_BUCKETS; ++bucket) {
+            merged.buckets[bucket] += samples.buckets[bucket];
+         }
+      }
+
+      if (merged.count == 0) {
+         continue;
+      }
+
+      // The percentiles are the middle of their bucket, at most the maximum
+      uint64_t percentiles[2] {};
+      uint64_t const ranks[2] { (merged.count + 1) / 2,
+         merged.count - merged.count / 100 };
+      uint64_t seen { 0 };
+      size_t found { 0 };
+
+      for (size_t bucket { 0 }; bucket != PROFILE_BUCKETS && found != 2;
+           ++bucket) {
+         seen += merged.buckets[bucket];
+
+         while (found != 2 && seen >= ranks[found]) {
+            percentiles[found++] = std::min(valueOf(bucket), merged.max);
+         }
+      }
+
+      int const length { std::snprintf(buffer,
+        sizeof(buffer),
+        "    %-16s %9llu %12.3f %11.3f %11.3f %11.3f %11.3f\n",
+        PHASE_NAMES[phase],
+        static_cast<unsigned long long>(merged.count),
+        merged.total / 1e6,
+        merged.total / 1e3 / merged.count,
+        percentiles[0] / 1e3,
+        percentiles[1] / 1e3,
+        merged.max / 1e3) };
+      report.append(buffer, length);
+   }
+
+   return report + "\n";
+}
+
+// Get the durations of the calling thread
+Profiler::ThreadSamples& Profiler::getThreadSamples() {
+   // Each thread looks its durations up once, then keeps them at hand
+   thread_local ThreadSamples* samples { nullptr };
+
+   if (samples == nullptr) {
+      std::lock_guard<std::mutex> lock { threads_mutex };
+      threads.push_back(std::make_unique<ThreadSamples>());
+      samples = threads.back().get();
+   }
+
+   return *samples;
+}
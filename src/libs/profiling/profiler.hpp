@@ -0,0 +1,202 @@
+/**
+ * @file profiler.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a profiler that measures the time spent in each phase of a
+ * run, from the reading of the data to the writing of the frames.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The phases are measured by PROFILE_SCOPE, which times the rest of the
+ * enclosing block. When the program is built without BAR_RACE_PROFILING, the
+ * macro expands to nothing, so the instrumentation costs nothing at all.
+ * The same measures feed the Tracer, which keeps when and on which thread the
+ * coarse phases happened.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef PROFILER_HPP_
+#define PROFILER_HPP_
+
+#include "BarRaceConfig.h" /// BAR_RACE_PROFILING
+#include "tracer.hpp" /// Tracer
+
+#include <atomic> /// atomic
+
+#include <chrono> /// steady_clock
+
+#include <cstddef> /// size_t
+#include <cstdint> /// uint64_t
+
+#include <memory> /// unique_ptr
+
+#include <mutex> /// mutex
+
+#include <string> /// string
+
+#include <vector> /// vector
+
+///< Definition of system constants >//
+constexpr size_t PROFILE_SUB_BUCKETS {
+   16
+}; ///< Buckets of the histogram in each power of two >//
+constexpr size_t PROFILE_BUCKETS {
+   64 * PROFILE_SUB_BUCKETS
+}; ///< Buckets of the histogram of the durations of a phase >//
+
+/**
+ * @brief Phases of a run that are measured
+ */
+enum ProfilePhase {
+   PHASE_CONFIGS, ///< Reading the configuration file
+   PHASE_READ, ///< Reading the lines of a bar chart
+   PHASE_PARSE_BLOCK, ///< Turning the lines of a bar chart into its bars
+   PHASE_SPLIT, ///< Splitting a line into its columns
+   PHASE_PARSE, ///< Parsing the value of a bar
+   PHASE_CATEGORIES, ///< Looking up the categories of the bars
+   PHASE_FRAME_BUILD, ///< Adding a bar chart to the database
+   PHASE_SORT, ///< Ordering the bars of a bar chart
+   PHASE_DATABASE_DRAW, ///< Composing a whole frame
+   PHASE_CHART_DRAW, ///< Drawing the bars and the axis of a frame
+   PHASE_BAR_DRAW, ///< Drawing a bar
+   PHASE_WRITE, ///< Writing the frames to the output
+   PHASE_SLEEP, ///< Waiting for the deadline of a frame
+   PHASE_COUNT, ///< Number of phases
+};
+
+/**
+ * @brief Profiler that keeps the durations of each phase of the run
+ *
+ * Each thread records its durations into its own histograms, so the threads
+ * that parse or render never wait for each other. A histogram has sixteen
+ * buckets for each power of two of nanoseconds, so the percentiles are
+ * within about 6% of the exact ones while the memory used stays the same
+ * however long the run is. The count, the total and the maximum are exact.
+ */
+class Profiler {
+   public:
+   /**
+    * @brief Get the instance shared by the whole program
+    * @return Reference to the profiler
+    */
+   static Profiler& getInstance();
+
+   /**
+    * @brief Start measuring the phases
+    */
+   void enable();
+
+   /**
+    * @brief Check if the phases are measured
+    * @return true if they are
+    */
+   static bool isEnabled() {
+      return enabled.load(std::memory_order_relaxed);
+   }
+
+   /**
+    * @brief Record a measure of a phase, in the histograms of the calling
+    * thread if the phases are measured, and as an event of the trace if the
+    * events are recorded and the phase is coarse enough to be traced
+    * @param phase The phase
+    * @param start When it started
+    * @param end When it ended
+    */
+   void record(ProfilePhase phase, std::chrono::steady_clock::time_point start,
+     std::chrono::steady_clock::time_point end);
+
+   /**
+    * @brief Get a table with the count, total, mean, p50, p99 and max of
+    * each phase measured, to be called once the other threads are done
+    * @return The text of the table
+    */
+   std::string getReport() const;
+
+   private:
+   /**
+    * @brief Durations of a phase measured by a thread
+    */
+   struct Samples {
+      uint64_t count { 0 }; ///< Number of durations
+      uint64_t total { 0 }; ///< Sum of the durations, in nanoseconds
+      uint64_t max { 0 }; ///< Longest duration, in nanoseconds
+      uint64_t buckets[PROFILE_BUCKETS] {}; ///< Histogram of the durations
+   };
+
+   /**
+    * @brief Durations of every phase measured by a thread
+    */
+   struct ThreadSamples {
+      Samples phases[PHASE_COUNT]; ///< Durations of each phase
+   };
+
+   Profiler() = default;
+
+   Profiler(Profiler const&) = delete;
+
+   Profiler& operator=(Profiler const&) = delete;
+
+   static std::atomic<bool> enabled; ///< The phases are measured
+
+   mutable std::mutex threads_mutex; ///< Mutex guarding the threads
+   std::vector<std::unique_ptr<ThreadSamples>>
+     threads; ///< Durations of each thread that recorded one
+
+   /**
+    * @brief Get the durations of the calling thread, registering them the
+    * first time
+    * @return Reference to the durations
+    */
+   ThreadSamples& getThreadSamples();
+};
+
+/**
+ * @brief Measure of a phase from its construction to its destruction
+ */
+class ProfileScope {
+   public:
+   /**
+    * @brief Start measuring a phase, if the profiler or the tracer is
+    * enabled
+    * @param phase_ The phase
+    */
+   explicit ProfileScope(ProfilePhase phase_) :
+      phase { phase_ },
+      active { Profiler::isEnabled() || Tracer::isEnabled() } {
+      if (active) {
+         start = std::chrono::steady_clock::now();
+      }
+   }
+
+   /**
+    * @brief Record the measure of the phase
+    */
+   ~ProfileScope() {
+      if (active) {
+         Profiler::getInstance().record(
+           phase, start, std::chrono::steady_clock::now());
+      }
+   }
+
+   ProfileScope(ProfileScope const&) = delete;
+
+   ProfileScope& operator=(ProfileScope const&) = delete;
+
+   private:
+   ProfilePhase phase; ///< Phase measured
+   bool active; ///< A measure was asked for when the phase started
+   std::chrono::steady_clock::time_point start; ///< When the phase started
+};
+
+#define PROFILE_CONCAT_(lhs, rhs) lhs##rhs
+#define PROFILE_CONCAT(lhs, rhs) PROFILE_CONCAT_(lhs, rhs)
+
+#ifdef BAR_RACE_PROFILING
+#define PROFILE_SCOPE(phase)                                                   \
+   ProfileScope const PROFILE_CONCAT(profile_scope_, __LINE__) { phase }
+#else
+#define PROFILE_SCOPE(phase) static_cast<void>(0)
+#endif
+
+#endif /// PROFILER_HPP_
@@ -0,0 +1,165 @@
+/**
+ * @file tracer.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the Tracer class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "tracer.hpp"
+
+#include <algorithm> /// min
+#include <cstdio> /// snprintf
+#include <fstream> /// ofstream
+
+// The events are not recorded until asked for
+std::atomic<bool> Tracer::enabled { false };
+
+// Get the single instance of Tracer
+Tracer& Tracer::getInstance() {
+   // Initialized once, even when the first calls come from several threads
+   static Tracer instance;
+   return instance;
+}
+
+// Destructor for the Tracer class
+Tracer::~Tracer() {
+   ThreadBuffer* buffer { buffers.load(std::memory_order_acquire) };
+
+   while (buffer != nullptr) {
+      ThreadBuffer* const next { buffer->next };
+      delete buffer;
+      buffer = next;
+   }
+}
+
+// Start recording events
+void Tracer::enable() {
+   // Set before any other thread is started, which then sees it
+   origin = Clock::now();
+   enabled.store(true, std::memory_order_relaxed);
+}
+
+// Record an event in the buffer of the calling thread
+void Tracer::record(char const* name, char const* category,
+  Clock::time_point start, Clock::time_point end) {
+   ThreadBuffer& buffer { getThreadBuffer() };
+
+   // Only this thread writes the buffer, so its count needs no exchange
+   uint64_t const index { buffer.recorded.load(std::memory_order_relaxed) };
+   Event& event { buffer.events[index % TRACE_BUFFER_EVENTS] };
+
+   event.name = name;
+   event.category = category;
+   event.start =
+     std::chrono::duration_cast<std::chrono::nanoseconds>(start - origin)
+       .count();
+   event.duration =
+     std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+       .count();
+
+   buffer.recorded.store(index + 1, std::memory_order_release);
+}
+
+// Write the events of every thread as a Chrome trace
+bool Tracer::write(std::string const& file) const {
+   std::ofstream output { file, std::ios::binary | std::ios::trunc };
+
+   if (!output) {
+      return false;
+   }
+
+   output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+             "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,"
+             "\"args\":{\"name\":\"bar-race\"}}";
+
+   char line[256];
+
+   for (ThreadBuffer const* buffer { buffers.load(std::memory_order_acquire) };
+        buffer != nullptr;
+        buffer = buffer->next) {
+      int length { std::snprintf(line,
+        sizeof(line),
+        ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,"
+        "\"args\":{\"name\":\"thread %u\"}}",
+        buffer->thread,
+        buffer->thread) };
+      output.write(line, length);
+
+      // The oldest events kept come first
+      uint64_t const recorded { buffer->recorded.load(
+        std::memory_order_acquire) };
+      uint64_t const kept { std::min<uint64_t>(recorded, TRACE_BUFFER_EVENTS) };
+
+      for (uint64_t index { recorded - kept }; index != recorded; ++index) {
+         Event const& event { buffer->events[index % TRACE_BUFFER_EVENTS] };
+         length = std::snprintf(line,
+           sizeof(line),
+           ",\n{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+           "\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+           event.name,
+           event.category,
+           event.start / 1e3,
+           event.duration / 1e3,
+           buffer->thread);
+         output.write(line, length);
+      }
+   }
+
+   output << "\n]}\n";
+   output.close();
+
+   return static_cast<bool>(output);
+}
+
+// Get the number of events kept by the buffers
+size_t Tracer::getEvents() const {
+   size_t events { 0 };
+
+   for (ThreadBuffer const* buffer { buffers.load(std::memory_order_acquire) };
+        buffer != nullptr;
+        buffer = buffer->next) {
+      events += std::min<uint64_t>(
+        buffer->recorded.load(std::memory_order_acquire), TRACE_BUFFER_EVENTS);
+   }
+
+   return events;
+}
+
+// Get the number of events overwritten in full buffers
+size_t Tracer::getDropped() const {
+   size_t dropped { 0 };
+
+   for (ThreadBuffer const* buffer { buffers.load(std::memory_order_acquire) };
+        buffer != nullptr;
+        buffer = buffer->next) {
+      uint64_t const recorded { buffer->recorded.load(
+        std::memory_order_acquire) };
+      dropped += recorded - std::min<uint64_t>(recorded, TRACE_BUFFER_EVENTS);
+   }
+
+   return dropped;
+}
+
+// Get the buffer of the calling thread
+Tracer::ThreadBuffer& Tracer::getThreadBuffer() {
+   thread_local ThreadBuffer* buffer { nullptr };
+
+   if (buffer == nullptr) {
+      buffer = new ThreadBuffer;
+      buffer->thread = threads.fetch_add(1, std::memory_order_relaxed);
+
+      // Push the buffer on the list of buffers without a lock
+      ThreadBuffer* head { buffers.load(std::memory_order_relaxed) };
+
+      do {
+         buffer->next = head;
+      } while (!buffers.compare_exchange_weak(
+        head, buffer, std::memory_order_release, std::memory_order_relaxed));
+   }
+
+   return *buffer;
+}
@@ -0,0 +1,143 @@
+/**
+ * @file tracer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a tracer that records when each phase of a run happened, on
+ * which thread, and writes it as a Chrome trace.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The trace is a JSON file of "complete" trace events, opened by
+ * chrome://tracing and by Perfetto (ui.perfetto.dev).
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TRACER_HPP_
+#define TRACER_HPP_
+
+#include <atomic> /// atomic
+
+#include <chrono> /// steady_clock
+
+#include <cstddef> /// size_t
+#include <cstdint> /// int64_t, uint32_t, uint64_t
+
+#include <string> /// string
+
+///< Definition of system constants >//
+constexpr size_t TRACE_BUFFER_EVENTS {
+   1 << 16
+}; ///< Events kept by each thread, the oldest are overwritten >//
+
+/**
+ * @brief Tracer that keeps the most recent events of each thread in memory
+ * until the end of the run
+ *
+ * Each thread records into a ring buffer of its own, which it registers once
+ * without taking a lock, so recording an event is a few stores and threads
+ * never wait for each other. A buffer publishes its events with a release
+ * store of its count, so it can be read while its thread still records. When
+ * a thread records more than TRACE_BUFFER_EVENTS events, its oldest ones are
+ * overwritten and counted as dropped.
+ */
+class Tracer {
+   public:
+   using Clock = std::chrono::steady_clock; ///< Monotonic clock
+
+   /**
+    * @brief Get the instance shared by the whole program
+    * @return Reference to the tracer
+    */
+   static Tracer& getInstance();
+
+   /**
+    * @brief Start recording events, timed from now
+    */
+   void enable();
+
+   /**
+    * @brief Check if the events are recorded
+    * @return true if they are
+    */
+   static bool isEnabled() {
+      return enabled.load(std::memory_order_relaxed);
+   }
+
+   /**
+    * @brief Record an event in the buffer of the calling thread
+    * @param name Name of the event, a string that outlives the tracer
+    * @param category Category of the event, a string that outlives the
+    * tracer
+    * @param start When the event started
+    * @param end When the event ended
+    */
+   void record(char const* name, char const* category, Clock::time_point start,
+     Clock::time_point end);
+
+   /**
+    * @brief Write the events of every thread as a Chrome trace
+    * @param file Path of the file
+    * @return true if the whole trace was written
+    */
+   bool write(std::string const& file) const;
+
+   /**
+    * @brief Get the number of events kept by the buffers
+    * @return Number of events
+    */
+   size_t getEvents() const;
+
+   /**
+    * @brief Get the number of events overwritten in full buffers
+    * @return Number of events
+    */
+   size_t getDropped() const;
+
+   private:
+   /**
+    * @brief An event, timed in nanoseconds from the start of the trace
+    */
+   struct Event {
+      char const* name; ///< Name of the event
+      char const* category; ///< Category of the event
+      int64_t start; ///< When the event started
+      int64_t duration; ///< How long the event took
+   };
+
+   /**
+    * @brief Ring buffer of the events of a thread
+    */
+   struct ThreadBuffer {
+      uint32_t thread; ///< Id of the thread in the trace
+      std::atomic<uint64_t> recorded { 0 }; ///< Events ever recorded
+      Event events[TRACE_BUFFER_EVENTS]; ///< The most recent events
+      ThreadBuffer* next { nullptr }; ///< Buffer registered before this one
+   };
+
+   Tracer() = default;
+
+   /**
+    * @brief Destructor for the Tracer class, which frees the buffers
+    */
+   ~Tracer();
+
+   Tracer(Tracer const&) = delete;
+
+   Tracer& operator=(Tracer const&) = delete;
+
+   static std::atomic<bool> enabled; ///< The events are recorded
+
+   Clock::time_point origin; ///< When the trace started
+   std::atomic<ThreadBuffer*> buffers { nullptr }; ///< Last buffer registered
+   std::atomic<uint32_t> threads { 0 }; ///< Buffers registered
+
+   /**
+    * @brief Get the buffer of the calling thread, registering it the first
+    * time
+    * @return Reference to the buffer
+    */
+   ThreadBuffer& getThreadBuffer();
+};
+
+#endif /// TRACER_HPP_
@@ -0,0 +1,77 @@
+/**
+ * @file linereader.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the line readers used to scan data files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "linereader.hpp"
+
+#include <cctype> /// isspace
+
+/// Read the next non-blank line of the region
+bool MappedLineReader::next(string_view& line) {
+   while (position < data.size()
+     && std::isspace(static_cast<unsigned char>(data[position]))) {
+      ++position;
+   }
+
+   if (position == data.size()) {
+      return false;
+   }
+
+   size_t end { data.find('\n', position) };
+
+   if (end == string_view::npos) {
+      end = data.size();
+   }
+
+   line = data.substr(position, end - position);
+   position = end;
+
+   return true;
+}
+
+/// Views into the region stay valid while the region exists
+bool MappedLineReader::isStable() const {
+   return true;
+}
+
+/// Get the number of bytes consumed so far
+size_t MappedLineReader::getBytesRead() const {
+   return position;
+}
+
+/// Read the next non-blank line of the stream
+bool StreamLineReader::next(string_view& line) {
+   int character { stream.peek() };
+
+   while (character != istream::traits_type::eof()
+     && std::isspace(character)) {
+      stream.get();
+      ++bytes_read;
+      character = stream.peek();
+   }
+
+   if (!std::getline(stream, buffer)) {
+      return false;
+   }
+
+   bytes_read += buffer.size() + (stream.eof() ? 0 : 1);
+   line = buffer;
+
+   return true;
+}
+
+/// Views into the buffer are overwritten by the next read
+bool StreamLineReader::isStable() const {
+   return false;
+}
+
+/// Get the number of bytes consumed so far
+size_t StreamLineReader::getBytesRead() const {
+   return bytes_read;
+}
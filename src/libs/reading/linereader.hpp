@@ -0,0 +1,111 @@
+/**
+ * @file linereader.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Definition of the line readers used to scan data files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A line reader hands out the lines of an input as string views. Leading
+ * whitespace (including blank lines) is skipped before each line, which
+ * mirrors the behavior of getline(stream >> std::ws, line). When the input is
+ * exhausted, the last line handed out is left untouched.
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef LINE_READER_HPP_
+#define LINE_READER_HPP_
+
+#include <string> /// string, getline
+using std::string;
+
+#include <string_view> /// string_view
+using std::string_view;
+
+#include <istream> /// istream
+using std::istream;
+
+/**
+ * @class LineReader
+ * @brief Interface of a source of lines
+ */
+class LineReader {
+   public:
+   /**
+    * @brief Virtual destructor for the LineReader interface
+    */
+   virtual ~LineReader() { }
+
+   /**
+    * @brief Read the next non-blank line
+    * @param line View that receives the line (unchanged when nothing is left)
+    * @return true if a line was read, false at the end of the input
+    */
+   virtual bool next(string_view& line) = 0;
+
+   /**
+    * @brief Check if the views handed out stay valid after the next read
+    * @return true if views are stable, false otherwise
+    */
+   virtual bool isStable() const = 0;
+
+   /**
+    * @brief Get the number of bytes consumed so far
+    * @return Number of bytes consumed
+    */
+   virtual size_t getBytesRead() const = 0;
+};
+
+/**
+ * @class MappedLineReader
+ * @brief Line reader over a contiguous memory region, such as a mapped file
+ *
+ * The lines are views into the region itself, so no byte is copied.
+ */
+class MappedLineReader : public LineReader {
+   public:
+   /**
+    * @brief Constructor for the MappedLineReader class
+    * @param data_ The region to scan
+    */
+   MappedLineReader(string_view data_) : data(data_) { }
+
+   bool next(string_view& line) override;
+
+   bool isStable() const override;
+
+   size_t getBytesRead() const override;
+
+   private:
+   string_view data; ///< The region being scanned
+   size_t position { 0 }; ///< Position of the next byte to scan
+};
+
+/**
+ * @class StreamLineReader
+ * @brief Line reader over an input stream
+ *
+ * Each line is copied into an internal buffer, so a view is only valid until
+ * the next read.
+ */
+class StreamLineReader : public LineReader {
+   public:
+   /**
+    * @brief Constructor for the StreamLineReader class
+    * @param stream_ The stream to read
+    */
+   StreamLineReader(istream& stream_) : stream(stream_) { }
+
+   bool next(string_view& line) override;
+
+   bool isStable() const override;
+
+   size_t getBytesRead() const override;
+
+   private:
+   istream& stream; ///< The stream being read
+   string buffer; ///< Buffer holding the last line read
+   size_t bytes_read { 0 }; ///< Number of bytes consumed
+};
+
+#endif /// LINE_READER_HPP_
@@ -0,0 +1,100 @@
+/**
+ * @file mappedfile.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the MappedFile class for read-only memory-mapped
+ * files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#include "mappedfile.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h> /// open, O_RDONLY
+#include <sys/mman.h> /// mmap, munmap, madvise
+#include <sys/stat.h> /// fstat, S_ISREG
+#include <unistd.h> /// close
+#define MAPPED_FILE_SUPPORTED
+#endif
+
+/// Constructor that maps the file at the given location
+MappedFile::MappedFile(string local_file) {
+   open(local_file);
+}
+
+/// Destructor, unmaps the file
+MappedFile::~MappedFile() {
+   close();
+}
+
+/// Maps the specified file, releasing any previous mapping
+void MappedFile::open(string local_file) {
+   close();
+
+#ifdef MAPPED_FILE_SUPPORTED
+   int descriptor { ::open(local_file.c_str(), O_RDONLY) };
+
+   if (descriptor == -1) {
+      throw std::runtime_error("The file does not exist or cannot be opened.");
+   }
+
+   struct stat status;
+
+   if (fstat(descriptor, &status) == -1 || !S_ISREG(status.st_mode)) {
+      ::close(descriptor);
+      throw std::runtime_error("Only regular files can be memory-mapped.");
+   }
+
+   size = static_cast<size_t>(status.st_size);
+
+   if (size != 0) {
+      void* region { mmap(nullptr, size, PROT_READ, MAP_PRIVATE, descriptor, 0) };
+
+      if (region == MAP_FAILED) {
+         ::close(descriptor);
+         size = 0;
+         throw std::runtime_error("The file cannot be memory-mapped.");
+      }
+
+      // The content is scanned once from start to end
+      madvise(region, size, MADV_SEQUENTIAL);
+      data = static_cast<char const*>(region);
+   }
+
+   // The mapping stays valid after the descriptor is closed
+   ::close(descriptor);
+   opened = true;
+#else
+   throw std::runtime_error("Memory-mapped files are not supported.");
+#endif
+}
+
+/// Releases the current mapping
+void MappedFile::close() {
+#ifdef MAPPED_FILE_SUPPORTED
+   if (data != nullptr) {
+      munmap(const_cast<char*>(data), size);
+   }
+#endif
+
+   data = nullptr;
+   size = 0;
+   opened = false;
+}
+
+/// Check if a file is currently mapped
+bool MappedFile::isOpen() const {
+   return opened;
+}
+
+/// Get a view over the whole mapped content
+string_view MappedFile::getView() const {
+   return data == nullptr ? string_view() : string_view(data, size);
+}
+
+/// Get the size of the mapped file
+size_t MappedFile::getSize() const {
+   return size;
+}
@@ -0,0 +1,96 @@
+/**
+ * @file mappedfile.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Definition of the MappedFile class for read-only memory-mapped files.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * The MappedFile class maps a whole file into the address space of the
+ * process, so its content can be scanned through string views without being
+ * copied into intermediate buffers.
+ *
+ * @copyright Copyright (c) 2023
+ */
+
+#ifndef MAPPED_FILE_HPP_
+#define MAPPED_FILE_HPP_
+
+#include <string> /// string
+using std::string;
+
+#include <string_view> /// string_view
+using std::string_view;
+
+#include <stdexcept> /// runtime_error
+
+/**
+ * @class MappedFile
+ * @brief Read-only memory mapping of a regular file
+ */
+class MappedFile {
+   public:
+   /**
+    * @brief Default constructor for the MappedFile class
+    */
+   MappedFile() { }
+
+   /**
+    * @brief Constructor that maps the file at the given location
+    * @param local_file The path of the file to map
+    */
+   MappedFile(string local_file);
+
+   /**
+    * @brief Destructor for the MappedFile class, unmaps the file
+    */
+   ~MappedFile();
+
+   /**
+    * @brief Deleted copy constructor, a mapping has a single owner
+    */
+   MappedFile(MappedFile const&) = delete;
+
+   /**
+    * @brief Deleted copy assignment operator, a mapping has a single owner
+    */
+   MappedFile& operator=(MappedFile const&) = delete;
+
+   /**
+    * @brief Maps the specified file, releasing any previous mapping
+    * @param local_file The path of the file to map
+    *
+    * @throw std::runtime_error If the file cannot be opened or mapped (for
+    * example, when it is not a regular file)
+    */
+   void open(string local_file);
+
+   /**
+    * @brief Releases the current mapping
+    */
+   void close();
+
+   /**
+    * @brief Check if a file is currently mapped
+    * @return true if a file is mapped, false otherwise
+    */
+   bool isOpen() const;
+
+   /**
+    * @brief Get a view over the whole mapped content
+    * @return View of the mapped bytes (empty for an empty file)
+    */
+   string_view getView() const;
+
+   /**
+    * @brief Get the size of the mapped file
+    * @return Size in bytes
+    */
+   size_t getSize() const;
+
+   private:
+   char const* data { nullptr }; ///< Start of the mapped region
+   size_t size { 0 }; ///< Size of the mapped region in bytes
+   bool opened { false }; ///< Flag indicating if a file is mapped
+};
+
+#endif /// MAPPED_FILE_HPP_
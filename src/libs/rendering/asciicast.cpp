@@ -0,0 +1,76 @@
+/**
+ * @file asciicast.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the asciicast v2 encoding functions.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "asciicast.hpp"
+
+#include <cstdio> /// snprintf
+
+// Append the header line of a recording
+void asciicast::appendHeader(
+  std::string& output, size_t width, size_t height, int64_t timestamp) {
+   char buffer[128];
+   int const size { std::snprintf(buffer,
+     sizeof(buffer),
+     "{\"version\": 2, \"width\": %zu, \"height\": %zu, \"timestamp\": %lld}\n",
+     width,
+     height,
+     static_cast<long long>(timestamp)) };
+
+   output.append(buffer, size);
+}
+
+// Append the line of an output event
+void asciicast::appendOutput(
+  std::string& output, double time, std::string_view bytes) {
+   char buffer[32];
+   int const size { std::snprintf(
+     buffer, sizeof(buffer), "[%.6f, \"o\", \"", time) };
+
+   output.append(buffer, size);
+   appendEscaped(output, bytes);
+   output.append("\"]\n");
+}
+
+// Append bytes as the contents of a JSON string
+void asciicast::appendEscaped(std::string& output, std::string_view bytes) {
+   static char const digits[] { "0123456789abcdef" };
+
+   size_t start { 0 };
+
+   for (size_t index { 0 }; index != bytes.size(); ++index) {
+      unsigned char const byte { static_cast<unsigned char>(bytes[index]) };
+
+      if (byte >= 0x20 && byte != '"' && byte != '\\') {
+         continue;
+      }
+
+      // Copy the run of plain bytes at once
+      output.append(bytes.substr(start, index - start));
+      start = index + 1;
+
+      if (byte == '"' || byte == '\\') {
+         output.push_back('\\');
+         output.push_back(static_cast<char>(byte));
+      } else if (byte == '\n') {
+         output.append("\\n");
+      } else if (byte == '\r') {
+         output.append("\\r");
+      } else if (byte == '\t') {
+         output.append("\\t");
+      } else {
+         output.append("\\u00");
+         output.push_back(digits[byte >> 4]);
+         output.push_back(digits[byte & 0xF]);
+      }
+   }
+
+   output.append(bytes.substr(start));
+}
@@ -0,0 +1,55 @@
+/**
+ * @file asciicast.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains the functions that encode terminal output as an asciicast
+ * v2 recording, the format played by asciinema.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * A recording is a header line with the size of the terminal, followed by one
+ * line per write to the terminal: [time, "o", "bytes written"], where time is
+ * in seconds from the start of the recording.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef ASCIICAST_HPP_
+#define ASCIICAST_HPP_
+
+#include <cstddef> /// size_t
+#include <cstdint> /// int64_t
+#include <string> /// string
+#include <string_view> /// string_view
+
+/**
+ * @brief Encoding of asciicast v2 recordings
+ */
+namespace asciicast {
+   /**
+    * @brief Append the header line of a recording
+    * @param output The string that receives the line
+    * @param width Columns of the terminal
+    * @param height Rows of the terminal
+    * @param timestamp Unix time at which the recording started
+    */
+   void appendHeader(
+     std::string& output, size_t width, size_t height, int64_t timestamp);
+
+   /**
+    * @brief Append the line of an output event
+    * @param output The string that receives the line
+    * @param time Seconds from the start of the recording
+    * @param bytes The bytes written to the terminal
+    */
+   void appendOutput(std::string& output, double time, std::string_view bytes);
+
+   /**
+    * @brief Append bytes as the contents of a JSON string
+    * @param output The string that receives the contents
+    * @param bytes The bytes, which must be valid UTF-8
+    */
+   void appendEscaped(std::string& output, std::string_view bytes);
+} // namespace asciicast
+
+#endif /// ASCIICAST_HPP_
@@ -0,0 +1,433 @@
+/**
+ * @file framebuffer.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the FrameBuffer class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "framebuffer.hpp"
+
+#include <algorithm> /// max
+#include <ctime> /// time
+#include <iostream> /// cout
+
+#include "asciicast.hpp" /// appendHeader, appendOutput
+#include "fnumber.hpp" /// formatFixed, appendFixed, NumberFormat
+#include "profiler.hpp" /// PROFILE_SCOPE
+
+#ifdef FRAME_BUFFER_WRITE_SUPPORTED
+#include <cerrno> /// errno, EINTR
+#include <fcntl.h> /// open, O_CREAT, O_TRUNC, O_WRONLY
+#include <unistd.h> /// close, write
+#endif
+
+// Constructor for the FrameBuffer class
+FrameBuffer::FrameBuffer(size_t _capacity) {
+   data.reserve(_capacity);
+   changes.reserve(_capacity);
+}
+
+// Destructor for the FrameBuffer class
+FrameBuffer::~FrameBuffer() {
+   close();
+}
+
+// Start a new frame
+void FrameBuffer::begin(double _time) {
+   data.clear();
+   frame_allocations = 0;
+   frame_time = _time;
+}
+
+// Set how the frames are written to the output
+void FrameBuffer::setFormat(FrameFormat format_, short _fps,
+  size_t _video_width, size_t _video_height) {
+   format = format_;
+   cast_height = 0;
+   video_started = false;
+   screen.reset();
+
+   if (format == FORMAT_Y4M || format == FORMAT_PPM) {
+      rasterizer.start(format == FORMAT_Y4M ? VIDEO_Y4M : VIDEO_PPM,
+        _fps,
+        _video_width,
+        _video_height);
+   } else if (format == FORMAT_SVG) {
+      svg.start(_fps);
+   }
+}
+
+// Encode the frames as another buffer does
+void FrameBuffer::setFormatOf(FrameBuffer const& other) {
+   format = other.format;
+   cast_height = 0;
+   video_started = false;
+   differential = false;
+   screen.reset();
+
+   if (other.isVideo()) {
+      rasterizer = other.rasterizer;
+   }
+}
+
+// Get how the frames are written to the output
+FrameFormat FrameBuffer::getFormat() const {
+   return format;
+}
+
+// Check if the frames are drawn as the images of a video
+bool FrameBuffer::isVideo() const {
+   return format == FORMAT_Y4M || format == FORMAT_PPM;
+}
+
+// Size the images of the video formats after a frame
+void FrameBuffer::fit(std::string_view frame_) {
+   if (isVideo()) {
+      rasterizer.fit(frame_);
+   }
+}
+
+// Enable or disable the differential mode
+void FrameBuffer::setDifferential(bool differential_) {
+   differential = differential_;
+   screen.reset();
+}
+
+// Check if the differential mode is enabled
+bool FrameBuffer::isDifferential() const {
+   return differential;
+}
+
+// Append text to the frame
+FrameBuffer& FrameBuffer::operator<<(std::string_view text) {
+   reserve(data, text.size());
+   data.append(text);
+   return *this;
+}
+
+// Append a character to the frame
+FrameBuffer& FrameBuffer::operator<<(char character) {
+   reserve(data, 1);
+   data.push_back(character);
+   return *this;
+}
+
+// Append a number in fixed notation to the frame
+void FrameBuffer::appendFixed(long double value, int precision) {
+   fos::NumberFormat format;
+   format.precision = precision;
+
+   char buffer[fos::NUMBER_CAPACITY];
+   size_t const size { fos::formatFixed(
+     buffer, sizeof(buffer), value, format) };
+
+   if (size != 0) {
+      *this << std::string_view(buffer, size);
+      return;
+   }
+
+   // Huge values do not fit in the local buffer
+   std::string text;
+   fos::appendFixed(text, value, format);
+   *this << text;
+}
+
+// Write the frames to a file instead of the standard output
+bool FrameBuffer::open(std::string const& path) {
+   close();
+
+#ifdef FRAME_BUFFER_WRITE_SUPPORTED
+   int const descriptor { ::open(
+     path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) };
+
+   if (descriptor < 0) {
+      return false;
+   }
+
+   output = descriptor;
+   failed = false;
+   screen.reset();
+
+   return true;
+#else
+   (void)path;
+   return false;
+#endif
+}
+
+// Write the frames kept by the batch and close the file opened
+bool FrameBuffer::close() {
+   bool written { true };
+
+   if (format == FORMAT_SVG) {
+      pending.append(svg.finish());
+   }
+
+   if (!pending.empty() && !failed) {
+      written = write(pending, output);
+   }
+
+   pending.clear();
+
+   // A batch that failed before is reported as well
+   written = written && !failed;
+   failed = false;
+
+#ifdef FRAME_BUFFER_WRITE_SUPPORTED
+   if (output != STANDARD_OUTPUT) {
+      written = ::close(output) == 0 && written;
+      output = STANDARD_OUTPUT;
+      screen.reset();
+   }
+#endif
+
+   return written;
+}
+
+// Get the file descriptor the frames are written to
+int FrameBuffer::getOutput() const {
+   return output;
+}
+
+// Keep the frames in memory until a number of bytes is reached
+void FrameBuffer::setBatch(size_t batch_) {
+   batch = batch_;
+   pending.reserve(batch);
+}
+
+// Write the frame to the output with a single write, or add it to the batch
+bool FrameBuffer::flush() {
+   if (failed) {
+      // The output already lost some bytes
+      return false;
+   }
+
+   // Text sent through cout before the frame goes out first
+   std::cout.flush();
+
+   return flushEncoded(encode());
+}
+
+// Write bytes encoded by another buffer as the next frame
+bool FrameBuffer::flushEncoded(std::string_view bytes) {
+   if (failed) {
+      return false;
+   }
+
+   if (isVideo() && !video_started) {
+      // The first image is preceded by the header, sized after it
+      video_started = true;
+      events.assign(rasterizer.getHeader());
+      events.append(bytes);
+      bytes = events;
+   }
+
+   bool written { true };
+
+   if (batch == 0 || (pending.empty() && bytes.size() >= batch)) {
+      // Frames as large as the batch are not copied to it
+      written = write(bytes, output);
+   } else {
+      reserve(pending, bytes.size());
+      pending.append(bytes);
+
+      if (pending.size() >= batch) {
+         written = write(pending, output);
+         pending.clear();
+      }
+   }
+
+   ++frames;
+   frame_bytes = bytes.size();
+   total_bytes += frame_bytes;
+   total_allocations += frame_allocations;
+
+   if (frame_bytes > max_frame_bytes) {
+      max_frame_bytes = frame_bytes;
+   }
+
+   return written;
+}
+
+// Encode the current frame as flush() would write it
+std::string_view FrameBuffer::encode() {
+   std::string_view bytes { data };
+
+   if (isVideo()) {
+      // Every image of a video is whole, so the text is not diffed
+      bytes = rasterizer.encode(data);
+   } else if (format == FORMAT_SVG) {
+      // The rows that did not change are referenced instead of diffed
+      bytes = svg.encode(data, frame_time);
+   } else if (differential) {
+      // A recording is as tall as its first frame, and as wide as needed
+      unsigned short rows { static_cast<unsigned short>(cast_height) };
+      unsigned short columns { 0 };
+
+      if (format != FORMAT_ASCIICAST) {
+         TerminalScreen::getSize(output, rows, columns);
+      }
+
+      changes.clear();
+      size_t const capacity { changes.capacity() };
+      screen.update(data, changes, rows, columns);
+
+      if (changes.capacity() != capacity) {
+         ++frame_allocations;
+      }
+
+      bytes = changes;
+   }
+
+   if (format == FORMAT_ASCIICAST) {
+      bytes = record(bytes);
+   }
+
+   return bytes;
+}
+
+// Encode the current frame as flush() would write it into a string
+void FrameBuffer::encode(std::string& output) {
+   if (isVideo()) {
+      output.clear();
+      rasterizer.encode(data, output);
+      return;
+   }
+
+   output.assign(encode());
+}
+
+// Check if a write to the output failed since it was opened
+bool FrameBuffer::hasFailed() const {
+   return failed;
+}
+
+// Get the bytes composed for the current frame
+std::string_view FrameBuffer::getFrame() const {
+   return data;
+}
+
+// Get the bytes written for the last frame
+size_t FrameBuffer::getFrameBytes() const {
+   return frame_bytes;
+}
+
+// Get the times the buffer grew in the current or last frame
+size_t FrameBuffer::getFrameAllocations() const {
+   return frame_allocations;
+}
+
+// Get the number of frames written
+size_t FrameBuffer::getFrames() const {
+   return frames;
+}
+
+// Get the bytes of every frame written
+size_t FrameBuffer::getTotalBytes() const {
+   return total_bytes;
+}
+
+// Get the bytes of the largest frame written
+size_t FrameBuffer::getMaxFrameBytes() const {
+   return max_frame_bytes;
+}
+
+// Get the times the buffer grew during every frame
+size_t FrameBuffer::getTotalAllocations() const {
+   return total_allocations;
+}
+
+// Get the number of system calls used to write every frame
+size_t FrameBuffer::getWrites() const {
+   return writes;
+}
+
+// Encode the bytes of a frame as asciicast events
+std::string_view FrameBuffer::record(std::string_view bytes) {
+   events.clear();
+   size_t const capacity { events.capacity() };
+
+   if (cast_height == 0) {
+      // The size of the terminal comes from the first frame, plus the row
+      // the cursor is left on
+      size_t width;
+      size_t height;
+      TerminalScreen measurer;
+      measurer.measure(data, width, height);
+      cast_height = height + 1;
+
+      asciicast::appendHeader(events,
+        std::max<size_t>(width, 1),
+        cast_height,
+        static_cast<int64_t>(std::time(nullptr)));
+   }
+
+   if (!differential) {
+      // Each frame replaces the last one instead of scrolling below it
+      changes.assign("\33[H\33[2J");
+      changes.append(bytes);
+      bytes = changes;
+   }
+
+   asciicast::appendOutput(events, frame_time, bytes);
+
+   if (events.capacity() != capacity) {
+      ++frame_allocations;
+   }
+
+   return events;
+}
+
+// Make room for more bytes, counting the growth if any
+void FrameBuffer::reserve(std::string& buffer, size_t bytes) {
+   if (buffer.size() + bytes > buffer.capacity()) {
+      // Grow geometrically, as the frames tend to have similar sizes
+      buffer.reserve(std::max(buffer.capacity() * 2, buffer.size() + bytes));
+      ++frame_allocations;
+   }
+}
+
+// Write bytes to a file descriptor
+bool FrameBuffer::write(std::string_view bytes, int descriptor) {
+   PROFILE_SCOPE(PHASE_WRITE);
+
+#ifdef FRAME_BUFFER_WRITE_SUPPORTED
+   char const* pending { bytes.data() };
+   size_t remaining { bytes.size() };
+
+   while (remaining != 0) {
+      ssize_t const result { ::write(descriptor, pending, remaining) };
+      ++writes;
+
+      if (result < 0) {
+         if (errno == EINTR) {
+            continue;
+         }
+
+         failed = true;
+         return false;
+      }
+
+      pending += result;
+      remaining -= result;
+   }
+
+   return true;
+#else
+   (void)descriptor;
+   std::cout.write(bytes.data(), bytes.size());
+   std::cout.flush();
+   ++writes;
+
+   if (std::cout.fail()) {
+      failed = true;
+      return false;
+   }
+
+   return true;
+#endif
+}
@@ -0,0 +1,335 @@
+/**
+ * @file framebuffer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a reusable byte buffer that composes a whole frame and
+ * writes it to the terminal at once.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FRAME_BUFFER_HPP_
+#define FRAME_BUFFER_HPP_
+
+#include <string> /// string
+
+#include <string_view> /// string_view
+
+#include "rasterizer.hpp" /// Rasterizer
+#include "svgwriter.hpp" /// SvgWriter
+#include "terminalscreen.hpp" /// TerminalScreen
+
+#if defined(__unix__) || defined(__APPLE__)
+#define FRAME_BUFFER_WRITE_SUPPORTED
+#endif
+
+///< Definition of system constants >//
+constexpr size_t DEFAULT_FRAME_CAPACITY {
+   1 << 16
+}; ///< Bytes reserved for a frame before any is composed >//
+constexpr int STANDARD_OUTPUT { 1 }; ///< File descriptor of the standard output
+
+/**
+ * @brief How the frames are written to the output
+ */
+enum FrameFormat {
+   FORMAT_TERMINAL, ///< As the bytes a terminal shows
+   FORMAT_ASCIICAST, ///< As the events of an asciicast v2 recording
+   FORMAT_Y4M, ///< As the images of a Y4M video
+   FORMAT_PPM, ///< As a sequence of PPM images
+   FORMAT_SVG, ///< As the frames of an animated SVG
+};
+
+/**
+ * @brief Buffer that receives every byte of a frame and writes them with a
+ * single system call
+ *
+ * The buffer keeps its memory from one frame to the next, so once it has
+ * grown to the size of the largest frame no further allocation is made. It
+ * counts the bytes and the growths of each frame and of the whole animation.
+ *
+ * In differential mode the frame is compared with the last one written and
+ * only the cells that changed are sent to the terminal. Frames written to a
+ * file can be batched, so many of them go out with a single system call,
+ * recorded as an asciicast with the time each frame is presented at, drawn
+ * as the images of a video or written as an animated SVG.
+ */
+class FrameBuffer {
+   public:
+   /**
+    * @brief Constructor for the FrameBuffer class
+    * @param _capacity Bytes to reserve (default: DEFAULT_FRAME_CAPACITY)
+    */
+   FrameBuffer(size_t _capacity = DEFAULT_FRAME_CAPACITY);
+
+   /**
+    * @brief Copy constructor for FrameBuffer (disabled), as the buffer owns
+    * the file it opens
+    */
+   FrameBuffer(FrameBuffer const&) = delete;
+
+   /**
+    * @brief Copy assignment operator for FrameBuffer (disabled)
+    */
+   FrameBuffer& operator=(FrameBuffer const&) = delete;
+
+   /**
+    * @brief Destructor for the FrameBuffer class, which closes the file
+    * opened, if any
+    */
+   ~FrameBuffer();
+
+   /**
+    * @brief Start a new frame, discarding the bytes not written
+    * @param _time Seconds from the start of the animation at which the frame
+    * is presented, recorded by the asciicast format (default: 0)
+    */
+   void begin(double _time = 0);
+
+   /**
+    * @brief Set how the frames are written to the output
+    * @param format_ The format, which starts a new recording
+    * @param _fps Frames per second, recorded by the Y4M and SVG formats
+    * (default: 24)
+    * @param _video_width Pixels on each row of the images of the Y4M and PPM
+    * formats (0 to size them after the first frame)
+    * @param _video_height Rows of pixels of the images of the Y4M and PPM
+    * formats (0 to size them after the first frame)
+    */
+   void setFormat(FrameFormat format_, short _fps = 24,
+     size_t _video_width = 0, size_t _video_height = 0);
+
+   /**
+    * @brief Encode the frames as another buffer does, with images of the
+    * same size, so they can be encoded on another thread and written by it
+    * @param other The buffer whose format is copied, sized by fit() for the
+    * video formats
+    */
+   void setFormatOf(FrameBuffer const& other);
+
+   /**
+    * @brief Get how the frames are written to the output
+    * @return The format
+    */
+   FrameFormat getFormat() const;
+
+   /**
+    * @brief Check if the frames are drawn as the images of a video, which
+    * are whole and can be encoded independently of each other
+    * @return true for the Y4M and PPM formats
+    */
+   bool isVideo() const;
+
+   /**
+    * @brief Size the images of the video formats after a frame, unless they
+    * are sized already
+    * @param frame_ The text of the frame
+    */
+   void fit(std::string_view frame_);
+
+   /**
+    * @brief Enable or disable the differential mode, which redraws the frames
+    * in place and writes only the cells that changed
+    * @param differential_ true to enable the differential mode
+    */
+   void setDifferential(bool differential_);
+
+   /**
+    * @brief Check if the differential mode is enabled
+    * @return true if it is enabled
+    */
+   bool isDifferential() const;
+
+   /**
+    * @brief Append text to the frame
+    * @param text The text
+    * @return Reference to the buffer
+    */
+   FrameBuffer& operator<<(std::string_view text);
+
+   /**
+    * @brief Append a character to the frame
+    * @param character The character
+    * @return Reference to the buffer
+    */
+   FrameBuffer& operator<<(char character);
+
+   /**
+    * @brief Append a number in fixed notation to the frame, as printf("%.*Lf")
+    * @param value The number
+    * @param precision Number of decimal places
+    */
+   void appendFixed(long double value, int precision);
+
+   /**
+    * @brief Write the frames to a file instead of the standard output
+    * @param path Path of the file, created or truncated
+    * @return true if the file was opened
+    */
+   bool open(std::string const& path);
+
+   /**
+    * @brief Write the frames kept by the batch, and the end of the SVG
+    * format, and close the file opened, if any, going back to the standard
+    * output
+    * @return true if every byte of every frame was written, including the
+    * batches written before
+    */
+   bool close();
+
+   /**
+    * @brief Get the file descriptor the frames are written to
+    * @return The descriptor
+    */
+   int getOutput() const;
+
+   /**
+    * @brief Keep the frames in memory until a number of bytes is reached and
+    * write them at once, which suits files better than terminals
+    * @param batch_ Bytes written at once (0 writes each frame at once)
+    */
+   void setBatch(size_t batch_);
+
+   /**
+    * @brief Write the frame to the output with a single write, retried only
+    * if the output accepts part of it, or add it to the batch
+    *
+    * Once a write failed, the frames are no longer written.
+    *
+    * @return true if every byte was written
+    */
+   bool flush();
+
+   /**
+    * @brief Write, as the next frame, bytes encoded by encode() on a buffer
+    * set with setFormatOf(), preceded by the header of the video for the
+    * first one
+    * @param bytes The bytes of the frame
+    * @return true if every byte was written
+    */
+   bool flushEncoded(std::string_view bytes);
+
+   /**
+    * @brief Encode the current frame as flush() would write it, without
+    * writing it
+    * @return The bytes, valid until the frame changes
+    */
+   std::string_view encode();
+
+   /**
+    * @brief Encode the current frame as flush() would write it into a
+    * string, which the images of the video formats are drawn straight into
+    * @param output The string that receives the bytes
+    */
+   void encode(std::string& output);
+
+   /**
+    * @brief Check if a write to the output failed since it was opened
+    * @return true if some bytes never reached the output
+    */
+   bool hasFailed() const;
+
+   /**
+    * @brief Get the bytes composed for the current frame, before they are
+    * compared with the screen or encoded
+    * @return The bytes, valid until the frame changes
+    */
+   std::string_view getFrame() const;
+
+   /**
+    * @brief Get the bytes written for the last frame
+    * @return Number of bytes
+    */
+   size_t getFrameBytes() const;
+
+   /**
+    * @brief Get the times the buffer grew in the current or last frame
+    * @return Number of allocations
+    */
+   size_t getFrameAllocations() const;
+
+   /**
+    * @brief Get the number of frames written
+    * @return Number of frames
+    */
+   size_t getFrames() const;
+
+   /**
+    * @brief Get the bytes of every frame written
+    * @return Number of bytes
+    */
+   size_t getTotalBytes() const;
+
+   /**
+    * @brief Get the bytes of the largest frame written
+    * @return Number of bytes
+    */
+   size_t getMaxFrameBytes() const;
+
+   /**
+    * @brief Get the times the buffer grew during every frame
+    * @return Number of allocations
+    */
+   size_t getTotalAllocations() const;
+
+   /**
+    * @brief Get the number of system calls used to write every frame
+    * @return Number of writes
+    */
+   size_t getWrites() const;
+
+   private:
+   std::string data; ///< Bytes of the current frame
+   std::string changes; ///< Bytes that update the screen to the frame
+   TerminalScreen screen; ///< Cells shown by the terminal
+   bool differential { false }; ///< Write only the cells that changed
+
+   FrameFormat format { FORMAT_TERMINAL }; ///< How the frames are written
+   double frame_time { 0 }; ///< When the current frame is presented
+   size_t cast_height { 0 }; ///< Rows of the recording (0: no header yet)
+   std::string events; ///< Recording events of the current frame
+   Rasterizer rasterizer; ///< Draws the images of the video formats
+   bool video_started { false }; ///< The header of the video was written
+   SvgWriter svg; ///< Writes the frames of the SVG format
+
+   int output { STANDARD_OUTPUT }; ///< File descriptor receiving the frames
+   size_t batch { 0 }; ///< Bytes of frames written at once (0: each frame)
+   std::string pending; ///< Frames not written yet by the batch
+   bool failed { false }; ///< A write to the output failed
+
+   size_t frame_bytes { 0 }; ///< Bytes written for the last frame
+
+   size_t frame_allocations { 0 }; ///< Growths of the current frame
+   size_t frames { 0 }; ///< Frames written
+   size_t total_bytes { 0 }; ///< Bytes of every frame written
+   size_t max_frame_bytes { 0 }; ///< Bytes of the largest frame written
+   size_t total_allocations { 0 }; ///< Growths during every frame
+   size_t writes { 0 }; ///< System calls used to write every frame
+
+   /**
+    * @brief Make room for more bytes, counting the growth if any
+    * @param buffer The buffer that receives the bytes
+    * @param bytes Number of bytes about to be appended
+    */
+   void reserve(std::string& buffer, size_t bytes);
+
+   /**
+    * @brief Encode the bytes of a frame as asciicast events, starting with
+    * the header of the recording for the first frame
+    * @param bytes The bytes that update the screen to the frame
+    * @return The events
+    */
+   std::string_view record(std::string_view bytes);
+
+   /**
+    * @brief Write bytes to a file descriptor, recording the failure if any
+    * @param bytes The bytes
+    * @param descriptor The descriptor
+    * @return true if every byte was written
+    */
+   bool write(std::string_view bytes, int descriptor);
+};
+
+#endif /// FRAME_BUFFER_HPP_
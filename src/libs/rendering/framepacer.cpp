@@ -0,0 +1,166 @@
+/**
+ * @file framepacer.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the FramePacer class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "framepacer.hpp"
+
+#include <algorithm> /// max
+#include <cmath> /// sqrt
+#include <thread> /// sleep_until
+
+#include "profiler.hpp" /// PROFILE_SCOPE
+
+///< Definition of system constants >//
+constexpr int64_t NANOSECONDS_PER_SECOND {
+   1000000000
+}; ///< Nanoseconds in a second >//
+
+// Constructor for the FramePacer class
+FramePacer::FramePacer(short _fps, PacePolicy _policy) {
+   start(_fps, _policy);
+}
+
+// Start a new animation
+void FramePacer::start(short fps_, PacePolicy policy_) {
+   fps = fps_ < 1 ? 1 : fps_;
+   policy = policy_;
+
+   start_time = Clock::now();
+   origin = start_time;
+   frame = 0;
+
+   presented = 0;
+   dropped = 0;
+   interval_mean = 0;
+   interval_m2 = 0;
+   max_lateness = 0;
+   render_total = 0;
+}
+
+// Wait for the deadline of the next frame
+bool FramePacer::wait(bool _last) {
+   // The first frame waits a period too, as the animation always did
+   ++frame;
+
+   if (policy == PACE_NONE) {
+      render_start = Clock::now();
+      return true;
+   }
+
+   Clock::time_point deadline { origin + offset(frame) };
+   Clock::time_point now { Clock::now() };
+
+   if (now - deadline > offset(1)) {
+      // More than a frame behind
+      if (policy == PACE_DROP && !_last) {
+         ++dropped;
+         return false;
+      }
+
+      // Draw it now and keep the next frames a period apart from it, instead
+      // of drawing them at once to catch up
+      origin = now - offset(frame);
+      deadline = now;
+   }
+
+   {
+      PROFILE_SCOPE(PHASE_SLEEP);
+      std::this_thread::sleep_until(deadline);
+   }
+
+   render_start = Clock::now();
+   max_lateness = std::max(max_lateness,
+     std::chrono::duration<double>(render_start - deadline).count());
+
+   return true;
+}
+
+// Mark the frame waited for as written to the output
+void FramePacer::present() {
+   Clock::time_point const now { Clock::now() };
+   render_total += std::chrono::duration<double>(now - render_start).count();
+
+   if (presented == 0) {
+      first_present = now;
+   } else {
+      // Update the mean and the deviations of the intervals (Welford)
+      double const interval {
+         std::chrono::duration<double>(now - last_present).count()
+      };
+      double const delta { interval - interval_mean };
+      interval_mean += delta / static_cast<double>(presented);
+      interval_m2 += delta * (interval - interval_mean);
+   }
+
+   last_present = now;
+   ++presented;
+}
+
+// Get the time the frame waited for is meant to be presented at
+double FramePacer::getPresentationTime() const {
+   return std::chrono::duration<double>(origin + offset(frame) - start_time)
+     .count();
+}
+
+// Get the target frames per second
+short FramePacer::getTargetRate() const {
+   return fps;
+}
+
+// Get the number of frames presented
+size_t FramePacer::getPresented() const {
+   return presented;
+}
+
+// Get the number of frames dropped
+size_t FramePacer::getDropped() const {
+   return dropped;
+}
+
+// Get the frames per second achieved
+double FramePacer::getAchievedRate() const {
+   double const elapsed {
+      std::chrono::duration<double>(last_present - first_present).count()
+   };
+
+   if (presented < 2 || elapsed <= 0) {
+      return 0;
+   }
+
+   return static_cast<double>(presented - 1) / elapsed;
+}
+
+// Get the standard deviation of the intervals between frames
+double FramePacer::getJitter() const {
+   if (presented < 3) {
+      return 0;
+   }
+
+   return std::sqrt(interval_m2 / static_cast<double>(presented - 2)) * 1000;
+}
+
+// Get the most a frame started after its deadline
+double FramePacer::getMaxLateness() const {
+   return max_lateness * 1000;
+}
+
+// Get the average time taken to render a frame
+double FramePacer::getAverageRenderTime() const {
+   if (presented == 0) {
+      return 0;
+   }
+
+   return render_total / static_cast<double>(presented) * 1000;
+}
+
+// Get the time from the frame 0 to the deadline of a frame
+std::chrono::nanoseconds FramePacer::offset(int64_t index) const {
+   return std::chrono::nanoseconds { index * NANOSECONDS_PER_SECOND / fps };
+}
@@ -0,0 +1,149 @@
+/**
+ * @file framepacer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a scheduler that paces the frames of an animation against
+ * absolute deadlines of a monotonic clock.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef FRAME_PACER_HPP_
+#define FRAME_PACER_HPP_
+
+#include <chrono> /// steady_clock, nanoseconds
+#include <cstddef> /// size_t
+#include <cstdint> /// int64_t
+
+/**
+ * @brief What the pacer does with a frame whose deadline passed more than a
+ * frame ago
+ */
+enum PacePolicy {
+   PACE_KEEP, ///< Draw it and move the later deadlines back
+   PACE_DROP, ///< Skip it, keeping the deadlines where they are
+   PACE_NONE, ///< Draw every frame at once, without waiting (export)
+};
+
+/**
+ * @brief Scheduler that waits for the deadline of each frame
+ *
+ * The deadline of the n-th frame is the start of the animation plus n frame
+ * periods, computed in nanoseconds, so the time spent composing and writing a
+ * frame is taken from the wait before the next one and rounding errors do not
+ * accumulate. When the animation falls behind, late frames are either drawn
+ * with the timeline restarted from them or dropped until it catches up.
+ *
+ * The pacer also measures how long each frame took to render and the
+ * intervals between frames, to report the achieved rate and its jitter.
+ */
+class FramePacer {
+   public:
+   using Clock = std::chrono::steady_clock; ///< Monotonic clock
+
+   /**
+    * @brief Constructor for the FramePacer class
+    * @param _fps Target frames per second (default: 24)
+    * @param _policy What to do with late frames (default: PACE_KEEP)
+    */
+   FramePacer(short _fps = 24, PacePolicy _policy = PACE_KEEP);
+
+   /**
+    * @brief Start a new animation, clearing the measures of the last one
+    * @param fps_ Target frames per second
+    * @param policy_ What to do with late frames
+    */
+   void start(short fps_, PacePolicy policy_);
+
+   /**
+    * @brief Wait for the deadline of the next frame
+    * @param _last true if it is the last frame, which is never dropped
+    * @return true if the frame must be drawn, false if it was dropped
+    */
+   bool wait(bool _last = false);
+
+   /**
+    * @brief Mark the frame waited for as written to the output
+    */
+   void present();
+
+   /**
+    * @brief Get the time the frame waited for is meant to be presented at,
+    * even when it is not waited for (PACE_NONE)
+    * @return Seconds from the start of the animation
+    */
+   double getPresentationTime() const;
+
+   /**
+    * @brief Get the target frames per second
+    * @return Frames per second
+    */
+   short getTargetRate() const;
+
+   /**
+    * @brief Get the number of frames presented
+    * @return Number of frames
+    */
+   size_t getPresented() const;
+
+   /**
+    * @brief Get the number of frames dropped
+    * @return Number of frames
+    */
+   size_t getDropped() const;
+
+   /**
+    * @brief Get the frames per second achieved between the first and the last
+    * frame presented
+    * @return Frames per second (0 with fewer than two frames)
+    */
+   double getAchievedRate() const;
+
+   /**
+    * @brief Get the standard deviation of the intervals between frames
+    * @return Milliseconds
+    */
+   double getJitter() const;
+
+   /**
+    * @brief Get the most a frame started after its deadline
+    * @return Milliseconds
+    */
+   double getMaxLateness() const;
+
+   /**
+    * @brief Get the average time taken to render a frame
+    * @return Milliseconds
+    */
+   double getAverageRenderTime() const;
+
+   private:
+   short fps; ///< Target frames per second
+   PacePolicy policy; ///< What to do with late frames
+
+   Clock::time_point start_time; ///< When the animation started
+   Clock::time_point origin; ///< Deadline of the frame 0
+   int64_t frame { 0 }; ///< Index of the frame waited for
+
+   Clock::time_point render_start; ///< When the frame waited for started
+   Clock::time_point first_present; ///< When the first frame was presented
+   Clock::time_point last_present; ///< When the last frame was presented
+
+   size_t presented { 0 }; ///< Frames presented
+   size_t dropped { 0 }; ///< Frames dropped
+   double interval_mean { 0 }; ///< Mean interval between frames, in seconds
+   double interval_m2 { 0 }; ///< Sum of squared deviations of the intervals
+   double max_lateness { 0 }; ///< Most a frame started late, in seconds
+   double render_total { 0 }; ///< Time spent rendering frames, in seconds
+
+   /**
+    * @brief Get the time from the frame 0 to the deadline of a frame
+    * @param index Index of the frame
+    * @return Offset of the deadline
+    */
+   std::chrono::nanoseconds offset(int64_t index) const;
+};
+
+#endif /// FRAME_PACER_HPP_
@@ -0,0 +1,399 @@
+/**
+ * @file rasterizer.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the Rasterizer class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "rasterizer.hpp"
+
+#include <algorithm> /// max, min
+#include <cstdio> /// snprintf
+#include <cstring> /// memcpy, memset
+
+namespace {
+   constexpr size_t GLYPH_TOP { 1 }; ///< Rows of dots above a character
+   constexpr uint8_t FULL_ROW {
+      (1 << CELL_DOTS_WIDE) - 1
+   }; ///< Dots of a row that fills the cell
+   constexpr char const* FULL_BLOCK { "\u2588" }; ///< Character of the bars
+
+   /// Printable ASCII characters, from the space to the tilde, in rows of 5
+   /// dots (the highest bit is the leftmost dot)
+   constexpr uint8_t FONT[95][GLYPH_HEIGHT] {
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // space
+      { 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04 }, // !
+      { 0x0A, 0x0A, 0x0A, 0x00, 0x00, 0x00, 0x00 }, // "
+      { 0x0A, 0x0A, 0x1F, 0x0A, 0x1F, 0x0A, 0x0A }, // #
+      { 0x04, 0x0F, 0x14, 0x0E, 0x05, 0x1E, 0x04 }, // $
+      { 0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03 }, // %
+      { 0x0C, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0D }, // &
+      { 0x04, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00 }, // apostrophe
+      { 0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02 }, // (
+      { 0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08 }, // )
+      { 0x00, 0x04, 0x15, 0x0E, 0x15, 0x04, 0x00 }, // *
+      { 0x00, 0x04, 0x04, 0x1F, 0x04, 0x04, 0x00 }, // +
+      { 0x00, 0x00, 0x00, 0x00, 0x0C, 0x04, 0x08 }, // ,
+      { 0x00, 0x00, 0x00, 0x1F, 0x00, 0x00, 0x00 }, // -
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C }, // .
+      { 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00 }, // /
+      { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E }, // 0
+      { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E }, // 1
+      { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F }, // 2
+      { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E }, // 3
+      { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 }, // 4
+      { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E }, // 5
+      { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E }, // 6
+      { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 }, // 7
+      { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E }, // 8
+      { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C }, // 9
+      { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x0C, 0x00 }, // :
+      { 0x00, 0x0C, 0x0C, 0x00, 0x0C, 0x04, 0x08 }, // ;
+      { 0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02 }, // <
+      { 0x00, 0x00, 0x1F, 0x00, 0x1F, 0x00, 0x00 }, // =
+      { 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08 }, // >
+      { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04 }, // ?
+      { 0x0E, 0x11, 0x01, 0x0D, 0x15, 0x15, 0x0E }, // @
+      { 0x0E, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // A
+      { 0x1E, 0x11, 0x11, 0x1E, 0x11, 0x11, 0x1E }, // B
+      { 0x0E, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0E }, // C
+      { 0x1C, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1C }, // D
+      { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x1F }, // E
+      { 0x1F, 0x10, 0x10, 0x1E, 0x10, 0x10, 0x10 }, // F
+      { 0x0E, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0F }, // G
+      { 0x11, 0x11, 0x11, 0x1F, 0x11, 0x11, 0x11 }, // H
+      { 0x0E, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, // I
+      { 0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0C }, // J
+      { 0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11 }, // K
+      { 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1F }, // L
+      { 0x11, 0x1B, 0x15, 0x15, 0x11, 0x11, 0x11 }, // M
+      { 0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11 }, // N
+      { 0x0E, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // O
+      { 0x1E, 0x11, 0x11, 0x1E, 0x10, 0x10, 0x10 }, // P
+      { 0x0E, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0D }, // Q
+      { 0x1E, 0x11, 0x11, 0x1E, 0x14, 0x12, 0x11 }, // R
+      { 0x0F, 0x10, 0x10, 0x0E, 0x01, 0x01, 0x1E }, // S
+      { 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // T
+      { 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0E }, // U
+      { 0x11, 0x11, 0x11, 0x11, 0x11, 0x0A, 0x04 }, // V
+      { 0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0A }, // W
+      { 0x11, 0x11, 0x0A, 0x04, 0x0A, 0x11, 0x11 }, // X
+      { 0x11, 0x11, 0x0A, 0x04, 0x04, 0x04, 0x04 }, // Y
+      { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1F }, // Z
+      { 0x0E, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0E }, // [
+      { 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00 }, // backslash
+      { 0x0E, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0E }, // ]
+      { 0x04, 0x0A, 0x11, 0x00, 0x00, 0x00, 0x00 }, // ^
+      { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F }, // _
+      { 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00 }, // `
+      { 0x00, 0x00, 0x0E, 0x01, 0x0F, 0x11, 0x0F }, // a
+      { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1E }, // b
+      { 0x00, 0x00, 0x0E, 0x10, 0x10, 0x11, 0x0E }, // c
+      { 0x01, 0x01, 0x0D, 0x13, 0x11, 0x11, 0x0F }, // d
+      { 0x00, 0x00, 0x0E, 0x11, 0x1F, 0x10, 0x0E }, // e
+      { 0x06, 0x09, 0x08, 0x1C, 0x08, 0x08, 0x08 }, // f
+      { 0x00, 0x0F, 0x11, 0x11, 0x0F, 0x01, 0x0E }, // g
+      { 0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11 }, // h
+      { 0x04, 0x00, 0x0C, 0x04, 0x04, 0x04, 0x0E }, // i
+      { 0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0C }, // j
+      { 0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12 }, // k
+      { 0x0C, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0E }, // l
+      { 0x00, 0x00, 0x1A, 0x15, 0x15, 0x11, 0x11 }, // m
+      { 0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11 }, // n
+      { 0x00, 0x00, 0x0E, 0x11, 0x11, 0x11, 0x0E }, // o
+      { 0x00, 0x00, 0x1E, 0x11, 0x1E, 0x10, 0x10 }, // p
+      { 0x00, 0x00, 0x0D, 0x13, 0x0F, 0x01, 0x01 }, // q
+      { 0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10 }, // r
+      { 0x00, 0x00, 0x0E, 0x10, 0x0E, 0x01, 0x1E }, // s
+      { 0x08, 0x08, 0x1C, 0x08, 0x08, 0x09, 0x06 }, // t
+      { 0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0D }, // u
+      { 0x00, 0x00, 0x11, 0x11, 0x11, 0x0A, 0x04 }, // v
+      { 0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0A }, // w
+      { 0x00, 0x00, 0x11, 0x0A, 0x04, 0x0A, 0x11 }, // x
+      { 0x00, 0x00, 0x11, 0x11, 0x0F, 0x01, 0x0E }, // y
+      { 0x00, 0x00, 0x1F, 0x02, 0x04, 0x08, 0x1F }, // z
+      { 0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02 }, // {
+      { 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04 }, // |
+      { 0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08 }, // }
+      { 0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00 }, // ~
+   };
+
+   // Get the rows of dots of a character
+   uint8_t const* glyphOf(ScreenCell const& cell) {
+      unsigned char const character { static_cast<unsigned char>(
+        cell.glyph[0]) };
+
+      if (cell.glyph_size == 1 && character >= ' ' && character <= '~') {
+         return FONT[character - ' '];
+      }
+
+      // Characters the font does not have
+      return FONT['?' - ' '];
+   }
+}
+
+// Start a new video
+void Rasterizer::start(
+  VideoEncoding encoding_, short _fps, size_t _width, size_t _height) {
+   encoding = encoding_;
+   fps = _fps < 1 ? 1 : _fps;
+
+   // A size is only kept when it has room for a tile
+   bool const sized { _width >= CELL_DOTS_WIDE && _height >= CELL_DOTS_HIGH };
+   video_width = sized ? _width : 0;
+   video_height = sized ? _height : 0;
+
+   columns = 0;
+   lines = 0;
+   width = 0;
+   height = 0;
+   drawn.clear();
+}
+
+// Size the images after a frame, unless they are sized already
+void Rasterizer::fit(std::string_view frame) {
+   if (columns != 0) {
+      return;
+   }
+
+   screen.layOut(frame, cells, rows);
+   resize();
+}
+
+// Draw a frame and encode its image
+std::string_view Rasterizer::encode(std::string_view frame) {
+   image.clear();
+   encode(frame, image);
+
+   return image;
+}
+
+// Draw a frame and append its image to a string
+void Rasterizer::encode(std::string_view frame, std::string& output) {
+   screen.layOut(frame, cells, rows);
+
+   if (columns == 0) {
+      resize();
+   }
+
+   // Cells out of the first frame are cut out of the image
+   ScreenCell const blank;
+   size_t const frame_lines { rows.size() - 1 };
+
+   for (size_t line { 0 }; line != lines; ++line) {
+      size_t const size { line < frame_lines ? rows[line + 1] - rows[line]
+                                             : 0 };
+      ScreenCell const* row { size != 0 ? &cells[rows[line]] : nullptr };
+      ScreenCell* tiles { &drawn[line * columns] };
+
+      for (size_t column { 0 }; column != columns; ++column) {
+         ScreenCell const& cell { column < size ? row[column] : blank };
+
+         if (!(cell == tiles[column])) {
+            drawTile(line, column, cell);
+            tiles[column] = cell;
+         }
+      }
+   }
+
+   appendImage(output);
+}
+
+// Get the header written before the first image of the video
+std::string Rasterizer::getHeader() const {
+   if (encoding != VIDEO_Y4M) {
+      return "";
+   }
+
+   char header[128];
+   int const size { std::snprintf(header,
+     sizeof(header),
+     "YUV4MPEG2 W%zu H%zu F%d:1 Ip A1:1 C444 XCOLORRANGE=FULL\n",
+     width,
+     height,
+     static_cast<int>(fps)) };
+
+   return std::string(header, size);
+}
+
+// Get the width of the images
+size_t Rasterizer::getWidth() const {
+   return width;
+}
+
+// Get the height of the images
+size_t Rasterizer::getHeight() const {
+   return height;
+}
+
+// Size the image and its tiles after the first frame and clear it
+void Rasterizer::resize() {
+   lines = std::max<size_t>(rows.size() - 1, 1);
+
+   for (size_t line { 0 }; line + 1 < rows.size(); ++line) {
+      columns = std::max(columns, rows[line + 1] - rows[line]);
+   }
+
+   columns = std::max<size_t>(columns, 1);
+   size_t dot { DOT_SIZE };
+
+   if (video_width != 0) {
+      // The largest dots that fit the frame, which is cut if even single
+      // pixel dots do not
+      dot = std::max<size_t>(
+        std::min(video_width / (columns * CELL_DOTS_WIDE),
+          video_height / (lines * CELL_DOTS_HIGH)),
+        1);
+      columns = std::min(columns, video_width / (CELL_DOTS_WIDE * dot));
+      lines = std::min(lines, video_height / (CELL_DOTS_HIGH * dot));
+   }
+
+   tile_width = CELL_DOTS_WIDE * dot;
+   tile_height = CELL_DOTS_HIGH * dot;
+   width = video_width != 0 ? video_width : columns * tile_width;
+   height = video_height != 0 ? video_height : lines * tile_height;
+   left = (width - columns * tile_width) / 2;
+   top = (height - lines * tile_height) / 2;
+   pixels.assign(tile_width, 0);
+
+   // Every tile starts as a blank cell
+   ScreenCell const blank;
+   uint8_t ink[3];
+   uint8_t paper[3];
+   getColors(blank, ink, paper);
+   drawn.assign(columns * lines, blank);
+
+   for (size_t plane { 0 }; plane != 3; ++plane) {
+      planes[plane].assign(width * height, paper[plane]);
+   }
+}
+
+// Draw a cell on a tile of the image
+void Rasterizer::drawTile(size_t line, size_t column, ScreenCell const& cell) {
+   uint8_t ink[3];
+   uint8_t paper[3];
+   getColors(cell, ink, paper);
+
+   // Dots of each row of the cell, the highest bit on the left
+   uint8_t dots[CELL_DOTS_HIGH] {};
+
+   if (cell.glyph_size == 3 && std::memcmp(cell.glyph, FULL_BLOCK, 3) == 0) {
+      std::memset(dots, FULL_ROW, sizeof(dots));
+   } else if (cell.glyph_size != 1 || cell.glyph[0] != ' ') {
+      uint8_t const* glyph { glyphOf(cell) };
+
+      for (size_t row { 0 }; row != GLYPH_HEIGHT; ++row) {
+         dots[GLYPH_TOP + row] = static_cast<uint8_t>(
+           glyph[row] << (CELL_DOTS_WIDE - GLYPH_WIDTH));
+      }
+   }
+
+   if (cell.attributes & (1u << 4)) {
+      // Underline
+      dots[CELL_DOTS_HIGH - 1] = FULL_ROW;
+   }
+
+   size_t const dot { tile_width / CELL_DOTS_WIDE };
+
+   for (size_t plane { 0 }; plane != 3; ++plane) {
+      uint8_t* origin { planes[plane].data()
+        + (top + line * tile_height) * width + left + column * tile_width };
+
+      for (size_t row { 0 }; row != CELL_DOTS_HIGH; ++row) {
+         // Build a row of pixels once and copy it to the rows of the dot
+         for (size_t index { 0 }; index != CELL_DOTS_WIDE; ++index) {
+            bool const on { ((dots[row] >> (CELL_DOTS_WIDE - 1 - index)) & 1)
+              != 0 };
+            std::memset(pixels.data() + index * dot,
+              on ? ink[plane] : paper[plane],
+              dot);
+         }
+
+         for (size_t copy { 0 }; copy != dot; ++copy) {
+            std::memcpy(origin + (row * dot + copy) * width,
+              pixels.data(),
+              tile_width);
+         }
+      }
+   }
+}
+
+// Get the colors a cell is drawn with
+void Rasterizer::getColors(
+  ScreenCell const& cell, uint8_t ink[3], uint8_t paper[3]) const {
+   short ink_index;
+   short paper_index;
+   cell.getPaletteColors(ink_index, paper_index);
+
+   uint8_t rgb[2][3];
+
+   for (size_t channel { 0 }; channel != 3; ++channel) {
+      rgb[0][channel] = ANSI_PALETTE[ink_index][channel];
+      rgb[1][channel] = ANSI_PALETTE[paper_index][channel];
+
+      if (cell.attributes & (1u << 2)) {
+         // Faint
+         rgb[0][channel] = static_cast<uint8_t>(rgb[0][channel] / 2);
+      }
+   }
+
+   for (size_t color { 0 }; color != 2; ++color) {
+      uint8_t* const target { color == 0 ? ink : paper };
+      int const red { rgb[color][0] };
+      int const green { rgb[color][1] };
+      int const blue { rgb[color][2] };
+
+      if (encoding == VIDEO_PPM) {
+         std::memcpy(target, rgb[color], 3);
+         continue;
+      }
+
+      // Full range BT.601 (JFIF), in fixed point with 8 fractional bits
+      target[0] = static_cast<uint8_t>(
+        (77 * red + 150 * green + 29 * blue + 128) >> 8);
+      target[1] = static_cast<uint8_t>(
+        std::min((-43 * red - 85 * green + 128 * blue + 32896) >> 8, 255));
+      target[2] = static_cast<uint8_t>(
+        std::min((128 * red - 107 * green - 21 * blue + 32896) >> 8, 255));
+   }
+}
+
+// Append the image to the output in the layout of the encoding
+void Rasterizer::appendImage(std::string& image) const {
+   size_t const pixels { width * height };
+
+   if (encoding == VIDEO_Y4M) {
+      // The planes one after the other
+      image.append("FRAME\n");
+
+      for (size_t plane { 0 }; plane != 3; ++plane) {
+         image.append(
+           reinterpret_cast<char const*>(planes[plane].data()), pixels);
+      }
+
+      return;
+   }
+
+   char header[64];
+   int const size { std::snprintf(
+     header, sizeof(header), "P6\n%zu %zu\n255\n", width, height) };
+   image.append(header, size);
+
+   // The channels of each pixel together
+   size_t const start { image.size() };
+   image.resize(start + pixels * 3);
+   char* target { &image[start] };
+   uint8_t const* red { planes[0].data() };
+   uint8_t const* green { planes[1].data() };
+   uint8_t const* blue { planes[2].data() };
+
+   for (size_t pixel { 0 }; pixel != pixels; ++pixel) {
+      target[pixel * 3] = static_cast<char>(red[pixel]);
+      target[pixel * 3 + 1] = static_cast<char>(green[pixel]);
+      target[pixel * 3 + 2] = static_cast<char>(blue[pixel]);
+   }
+}
@@ -0,0 +1,176 @@
+/**
+ * @file rasterizer.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a software rasterizer that draws the frames of the terminal
+ * as images, encoded as a Y4M video or a sequence of PPM images.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Y4M (YUV4MPEG2) is the raw video read by encoders such as ffmpeg and x264
+ * from a pipe. A PPM sequence is a stream of binary PPM (P6) images, one after
+ * the other, read by ffmpeg as "-f image2pipe -c:v ppm" and by netpbm.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef RASTERIZER_HPP_
+#define RASTERIZER_HPP_
+
+#include <cstddef> /// size_t
+#include <cstdint> /// uint8_t
+
+#include <string> /// string
+
+#include <string_view> /// string_view
+
+#include <vector> /// vector
+
+#include "terminalscreen.hpp" /// ScreenCell, TerminalScreen
+
+///< Definition of system constants >//
+constexpr size_t GLYPH_WIDTH { 5 }; ///< Columns of dots of a character
+constexpr size_t GLYPH_HEIGHT { 7 }; ///< Rows of dots of a character
+constexpr size_t CELL_DOTS_WIDE { 6 }; ///< Columns of dots of a cell
+constexpr size_t CELL_DOTS_HIGH { 10 }; ///< Rows of dots of a cell
+constexpr size_t DOT_SIZE {
+   2
+}; ///< Pixels on each side of a dot, when the size of the images is not set
+
+/**
+ * @brief How the images are encoded
+ */
+enum VideoEncoding {
+   VIDEO_Y4M, ///< Y4M video, in full range YCbCr 4:4:4
+   VIDEO_PPM, ///< Sequence of PPM images, in RGB
+};
+
+/**
+ * @brief Rasterizer that draws the cells of a frame with a bitmap font
+ *
+ * Each cell of the terminal is a tile of the image, drawn with the colors of
+ * its style and a 5x7 font embedded in the program, and the block characters
+ * of the bars fill the whole tile. The image keeps its size from the first
+ * frame, and only the tiles whose cell changed since the last frame are drawn
+ * again.
+ *
+ * When the size of the images is set, the dots are scaled by the largest
+ * whole number that fits the first frame in it, and the frame is centered.
+ * Otherwise each dot is DOT_SIZE pixels wide and the image is as large as
+ * the frame. The tiles are drawn straight into the planes of the encoding, after
+ * converting the two colors of the cell once, so a tile is made of runs of
+ * bytes copied row after row.
+ *
+ * A copy of a sized Rasterizer draws images of the same size, so several of
+ * them can draw the frames of one video on different threads. Each one only
+ * redraws the tiles that changed since the last frame it drew itself.
+ */
+class Rasterizer {
+   public:
+   /**
+    * @brief Start a new video, whose size is taken from its first frame
+    * @param encoding_ How the images are encoded
+    * @param _fps Frames per second, recorded by the Y4M header (default: 24)
+    * @param _width Pixels on each row of the images (0 to size them after
+    * the first frame)
+    * @param _height Rows of pixels of the images (0 to size them after the
+    * first frame)
+    */
+   void start(VideoEncoding encoding_, short _fps = 24, size_t _width = 0,
+     size_t _height = 0);
+
+   /**
+    * @brief Size the images after a frame, unless they are sized already
+    * @param frame The text of the frame, as written to a terminal
+    */
+   void fit(std::string_view frame);
+
+   /**
+    * @brief Draw a frame and encode its image, sizing the images after it if
+    * it is the first one
+    * @param frame The text of the frame, as written to a terminal
+    * @return The bytes of the image, valid until the next frame
+    */
+   std::string_view encode(std::string_view frame);
+
+   /**
+    * @brief Draw a frame and append its image to a string, which saves a
+    * copy when the image is kept
+    * @param frame The text of the frame, as written to a terminal
+    * @param output The string that receives the bytes of the image
+    */
+   void encode(std::string_view frame, std::string& output);
+
+   /**
+    * @brief Get the header written before the first image of the video
+    * @return The header (empty for a PPM sequence)
+    */
+   std::string getHeader() const;
+
+   /**
+    * @brief Get the width of the images
+    * @return Pixels (0 before the first frame)
+    */
+   size_t getWidth() const;
+
+   /**
+    * @brief Get the height of the images
+    * @return Pixels (0 before the first frame)
+    */
+   size_t getHeight() const;
+
+   private:
+   VideoEncoding encoding { VIDEO_Y4M }; ///< How the images are encoded
+   short fps { 24 }; ///< Frames per second of the video
+   size_t video_width { 0 }; ///< Width set for the images (0: not set)
+   size_t video_height { 0 }; ///< Height set for the images (0: not set)
+
+   TerminalScreen screen; ///< Lays the frames out into cells
+   std::vector<ScreenCell> cells; ///< Cells of the frame, row after row
+   std::vector<size_t> rows; ///< Start of each row of the frame, plus end
+   std::vector<ScreenCell> drawn; ///< Cell drawn on each tile of the image
+
+   size_t columns { 0 }; ///< Tiles on each row of the image (0: no frame)
+   size_t lines { 0 }; ///< Rows of tiles of the image
+   size_t width { 0 }; ///< Pixels on each row of the image
+   size_t height { 0 }; ///< Rows of pixels of the image
+   size_t tile_width { 0 }; ///< Pixels on each row of a tile
+   size_t tile_height { 0 }; ///< Rows of pixels of a tile
+   size_t left { 0 }; ///< Pixels left of the first column of tiles
+   size_t top { 0 }; ///< Rows of pixels above the first row of tiles
+   std::vector<uint8_t> pixels; ///< A row of pixels of the tile drawn
+   std::vector<uint8_t> planes[3]; ///< R, G, B or Y, Cb, Cr of each pixel
+
+   std::string image; ///< Bytes of the last image encoded
+
+   /**
+    * @brief Size the image and its tiles after the first frame and clear it
+    */
+   void resize();
+
+   /**
+    * @brief Draw a cell on a tile of the image
+    * @param line Row of the tile
+    * @param column Column of the tile
+    * @param cell The cell
+    */
+   void drawTile(size_t line, size_t column, ScreenCell const& cell);
+
+   /**
+    * @brief Get the colors a cell is drawn with, in the color space of the
+    * encoding
+    * @param cell The cell
+    * @param ink Receives the color of the character
+    * @param paper Receives the color of the rest of the tile
+    */
+   void getColors(ScreenCell const& cell, uint8_t ink[3], uint8_t paper[3])
+     const;
+
+   /**
+    * @brief Append the image to the output in the layout of the encoding
+    * @param image The string that receives the bytes of the image
+    */
+   void appendImage(std::string& image) const;
+};
+
+#endif /// RASTERIZER_HPP_
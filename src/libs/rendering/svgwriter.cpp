@@ -0,0 +1,294 @@
+/**
+ * @file svgwriter.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the SvgWriter class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "svgwriter.hpp"
+
+#include <algorithm> /// max
+#include <cstdio> /// snprintf
+#include <cstring> /// memcmp
+
+namespace {
+   constexpr size_t TEXT_BASELINE { 15 }; ///< Baseline of the text of a row
+   constexpr char const* FULL_BLOCK { "\u2588" }; ///< Character of the bars
+
+   // Check if a cell shows the character of the bars
+   bool isBlock(ScreenCell const& cell) {
+      return cell.glyph_size == 3
+        && std::memcmp(cell.glyph, FULL_BLOCK, 3) == 0;
+   }
+
+   // Check if a cell shows a space, which leaves only its background
+   bool isBlank(ScreenCell const& cell) {
+      return cell.glyph_size == 1 && cell.glyph[0] == ' '
+        && (cell.attributes & (1u << 4)) == 0;
+   }
+
+   // Get the color that fills a cell (-1: the background of the SVG)
+   short fillOf(ScreenCell const& cell) {
+      short ink;
+      short paper;
+      cell.getPaletteColors(ink, paper);
+
+      if (isBlock(cell)) {
+         return ink;
+      }
+
+      return paper == DEFAULT_PAPER ? -1 : paper;
+   }
+
+   // Get the style of the text of a cell: its color and attributes
+   short textStyleOf(ScreenCell const& cell) {
+      short ink;
+      short paper;
+      cell.getPaletteColors(ink, paper);
+
+      return static_cast<short>(ink | ((cell.attributes & (1u << 1)) << 3)
+        | ((cell.attributes & (1u << 4)) << 1));
+   }
+
+   // Append the text of a cell, escaped for XML
+   void appendEscaped(std::string& output, ScreenCell const& cell) {
+      if (cell.glyph[0] == '&') {
+         output.append("&amp;");
+      } else if (cell.glyph[0] == '<') {
+         output.append("&lt;");
+      } else if (cell.glyph[0] == '>') {
+         output.append("&gt;");
+      } else {
+         output.append(cell.glyph, cell.glyph_size);
+      }
+   }
+}
+
+// Start a new animation
+void SvgWriter::start(short _fps) {
+   fps = _fps < 1 ? 1 : _fps;
+   started = false;
+   definitions.clear();
+}
+
+// Encode a frame
+std::string_view SvgWriter::encode(std::string_view frame, double time) {
+   screen.layOut(frame, cells, rows);
+   output.clear();
+
+   if (!started) {
+      appendHeader();
+      started = true;
+   }
+
+   char buffer[96];
+   bool defining { false };
+   uses.clear();
+
+   for (size_t line { 0 }; line + 1 < rows.size(); ++line) {
+      size_t const size { rows[line + 1] - rows[line] };
+
+      if (size == 0) {
+         continue;
+      }
+
+      buildRow(&cells[rows[line]], size);
+
+      if (row.empty()) {
+         continue;
+      }
+
+      auto const found { definitions.find(row) };
+      size_t id;
+
+      if (found != definitions.end()) {
+         id = found->second;
+      } else {
+         // Define the row once, before the first frame that shows it
+         if (definitions.size() == SVG_ROW_DEFINITIONS) {
+            definitions.clear();
+         }
+
+         if (!defining) {
+            output.append("<defs>\n");
+            defining = true;
+         }
+
+         id = next_id++;
+         int const length { std::snprintf(
+           buffer, sizeof(buffer), "<g id=\"r%zu\">", id) };
+         output.append(buffer, length);
+         output.append(row);
+         output.append("</g>\n");
+         definitions.emplace(row, id);
+      }
+
+      int const length { std::snprintf(buffer,
+        sizeof(buffer),
+        "<use xlink:href=\"#r%zu\" y=\"%zu\"/>\n",
+        id,
+        line * SVG_CELL_HEIGHT) };
+      uses.append(buffer, length);
+   }
+
+   if (defining) {
+      output.append("</defs>\n");
+   }
+
+   int const length { std::snprintf(buffer,
+     sizeof(buffer),
+     "<g class=\"f\" style=\"animation-delay:%.6fs\">\n",
+     time) };
+   output.append(buffer, length);
+   output.append(uses);
+   output.append("</g>\n");
+
+   return output;
+}
+
+// End the animation
+std::string_view SvgWriter::finish() {
+   output.clear();
+
+   if (started) {
+      output.append("</svg>\n");
+      started = false;
+      definitions.clear();
+   }
+
+   return output;
+}
+
+// Append the header of the SVG and its style sheet
+void SvgWriter::appendHeader() {
+   // The size of the SVG comes from the first frame
+   size_t columns { 1 };
+
+   for (size_t line { 0 }; line + 1 < rows.size(); ++line) {
+      columns = std::max(columns, rows[line + 1] - rows[line]);
+   }
+
+   size_t const width { columns * SVG_CELL_WIDTH };
+   size_t const height { std::max<size_t>(rows.size() - 1, 1)
+     * SVG_CELL_HEIGHT };
+
+   char buffer[256];
+   int length { std::snprintf(buffer,
+     sizeof(buffer),
+     "<svg xmlns=\"http://www.w3.org/2000/svg\" "
+     "xmlns:xlink=\"http://www.w3.org/1999/xlink\" width=\"%zu\" "
+     "height=\"%zu\" viewBox=\"0 0 %zu %zu\" xml:space=\"preserve\">\n",
+     width,
+     height,
+     width,
+     height) };
+   output.append(buffer, length);
+
+   // Each frame is shown for a frame period, and the last one stays
+   output.append("<style>\n"
+                 "text{font-family:monospace;font-size:16px;white-space:pre}\n"
+                 ".b{font-weight:bold}\n"
+                 ".u{text-decoration:underline}\n");
+   length = std::snprintf(buffer,
+     sizeof(buffer),
+     ".f{visibility:hidden;animation:show %.6fs step-end}\n",
+     1.0 / fps);
+   output.append(buffer, length);
+   output.append(".f:last-of-type{animation-fill-mode:forwards}\n"
+                 "@keyframes show{from,to{visibility:visible}}\n");
+
+   for (short color { 0 }; color != 16; ++color) {
+      length = std::snprintf(buffer,
+        sizeof(buffer),
+        ".c%d{fill:#%02x%02x%02x}\n",
+        color,
+        ANSI_PALETTE[color][0],
+        ANSI_PALETTE[color][1],
+        ANSI_PALETTE[color][2]);
+      output.append(buffer, length);
+   }
+
+   output.append("</style>\n");
+   length = std::snprintf(buffer,
+     sizeof(buffer),
+     "<rect width=\"100%%\" height=\"100%%\" class=\"c%d\"/>\n",
+     DEFAULT_PAPER);
+   output.append(buffer, length);
+}
+
+// Build the markup of a row of cells
+void SvgWriter::buildRow(ScreenCell const* row_cells, size_t size) {
+   row.clear();
+
+   char buffer[128];
+
+   // The bars and the backgrounds, as runs of cells of the same color
+   for (size_t column { 0 }; column < size;) {
+      short const fill { fillOf(row_cells[column]) };
+      size_t end { column + 1 };
+
+      while (end < size && fillOf(row_cells[end]) == fill) {
+         ++end;
+      }
+
+      if (fill != -1) {
+         int const length { std::snprintf(buffer,
+           sizeof(buffer),
+           "<rect x=\"%zu\" width=\"%zu\" height=\"%zu\" class=\"c%d\"/>",
+           column * SVG_CELL_WIDTH,
+           (end - column) * SVG_CELL_WIDTH,
+           SVG_CELL_HEIGHT,
+           fill) };
+         row.append(buffer, length);
+      }
+
+      column = end;
+   }
+
+   // The text, as runs of characters of the same style, which go on over
+   // the spaces between them
+   for (size_t column { 0 }; column < size;) {
+      if (isBlock(row_cells[column]) || isBlank(row_cells[column])) {
+         ++column;
+         continue;
+      }
+
+      short const style { textStyleOf(row_cells[column]) };
+      size_t last { column };
+
+      for (size_t end { column + 1 }; end < size && !isBlock(row_cells[end]);
+           ++end) {
+         if (isBlank(row_cells[end])) {
+            continue;
+         }
+
+         if (textStyleOf(row_cells[end]) != style) {
+            break;
+         }
+
+         last = end;
+      }
+
+      int const length { std::snprintf(buffer,
+        sizeof(buffer),
+        "<text x=\"%zu\" y=\"%zu\" textLength=\"%zu\" class=\"c%d%s%s\">",
+        column * SVG_CELL_WIDTH,
+        TEXT_BASELINE,
+        (last - column + 1) * SVG_CELL_WIDTH,
+        style & 0xF,
+        (style & 0x10) != 0 ? " b" : "",
+        (style & 0x20) != 0 ? " u" : "") };
+      row.append(buffer, length);
+
+      for (size_t index { column }; index <= last; ++index) {
+         appendEscaped(row, row_cells[index]);
+      }
+
+      row.append("</text>");
+      column = last + 1;
+   }
+}
@@ -0,0 +1,105 @@
+/**
+ * @file svgwriter.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a writer that turns the frames of the terminal into a
+ * single animated SVG, streamed frame after frame.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * Each frame is a group of the SVG shown by a CSS animation for one frame
+ * period, starting at the time the frame is presented. The last group stays
+ * on the screen when the animation ends.
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef SVG_WRITER_HPP_
+#define SVG_WRITER_HPP_
+
+#include <cstddef> /// size_t
+
+#include <string> /// string
+
+#include <string_view> /// string_view
+
+#include <unordered_map> /// unordered_map
+
+#include <vector> /// vector
+
+#include "terminalscreen.hpp" /// ScreenCell, TerminalScreen
+
+///< Definition of system constants >//
+constexpr size_t SVG_CELL_WIDTH { 10 }; ///< Width of a cell, in SVG units
+constexpr size_t SVG_CELL_HEIGHT { 20 }; ///< Height of a cell, in SVG units
+constexpr size_t SVG_ROW_DEFINITIONS {
+   4096
+}; ///< Rows remembered to be referenced by later frames >//
+
+/**
+ * @brief Writer of the frames of the terminal as an animated SVG
+ *
+ * The colors of the palette are CSS classes of a style sheet written once,
+ * in the header. Each row of a frame is defined once, the first time it is
+ * drawn, and the frames only reference their rows. So the rows that do not
+ * change, such as the title, the axis, the source and the legend, are written
+ * a single time, and a frame adds only the rows of the bars that moved.
+ *
+ * The rows remembered are bounded, and forgotten at once when the bound is
+ * reached, so long animations are written with bounded memory.
+ */
+class SvgWriter {
+   public:
+   /**
+    * @brief Start a new animation, whose size is taken from its first frame
+    * @param _fps Frames per second, the time each frame is shown for
+    * (default: 24)
+    */
+   void start(short _fps = 24);
+
+   /**
+    * @brief Encode a frame, preceded by the header of the SVG for the first
+    * frame
+    * @param frame The text of the frame, as written to a terminal
+    * @param time Seconds from the start of the animation at which the frame
+    * is presented
+    * @return The bytes of the frame, valid until the next frame
+    */
+   std::string_view encode(std::string_view frame, double time);
+
+   /**
+    * @brief End the animation
+    * @return The bytes that close the SVG (empty if no frame was encoded)
+    */
+   std::string_view finish();
+
+   private:
+   short fps { 24 }; ///< Frames per second of the animation
+   bool started { false }; ///< The header of the SVG was written
+
+   TerminalScreen screen; ///< Lays the frames out into cells
+   std::vector<ScreenCell> cells; ///< Cells of the frame, row after row
+   std::vector<size_t> rows; ///< Start of each row of the frame, plus end
+
+   std::unordered_map<std::string, size_t>
+     definitions; ///< Id of each row defined, by its markup
+   size_t next_id { 0 }; ///< Id of the next row defined
+
+   std::string row; ///< Markup of the row being encoded
+   std::string uses; ///< References of the frame to its rows
+   std::string output; ///< Bytes of the last frame encoded
+
+   /**
+    * @brief Append the header of the SVG and its style sheet
+    */
+   void appendHeader();
+
+   /**
+    * @brief Build the markup of a row of cells into row
+    * @param row_cells The first cell of the row
+    * @param size Number of cells of the row
+    */
+   void buildRow(ScreenCell const* row_cells, size_t size);
+};
+
+#endif /// SVG_WRITER_HPP_
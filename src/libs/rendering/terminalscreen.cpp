@@ -0,0 +1,412 @@
+/**
+ * @file terminalscreen.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Implementation of the TerminalScreen class.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "terminalscreen.hpp"
+
+#include <algorithm> /// max, equal, swap
+
+#include <charconv> /// to_chars
+
+#include <cstring> /// memcmp
+
+#if defined(__unix__) || defined(__APPLE__)
+#define TERMINAL_SCREEN_IOCTL_SUPPORTED
+#include <sys/ioctl.h> /// ioctl, winsize, TIOCGWINSZ
+#include <unistd.h> /// isatty
+#endif
+
+namespace {
+   constexpr size_t MAXIMUM_GAP {
+      6
+   }; ///< Unchanged cells rewritten rather than skipped with a cursor move
+   constexpr size_t TAB_SIZE { 8 }; ///< Columns between tab stops
+
+   // Apply the parameters of an SGR sequence to a style
+   void applyStyle(std::string_view parameters, ScreenCell& style) {
+      size_t start { 0 };
+
+      while (start <= parameters.size()) {
+         size_t end { parameters.find(';', start) };
+         end = end == std::string_view::npos ? parameters.size() : end;
+
+         int code { 0 };
+
+         for (size_t index { start }; index < end; ++index) {
+            if (parameters[index] < '0' || parameters[index] > '9') {
+               code = -1;
+               break;
+            }
+
+            code = code * 10 + (parameters[index] - '0');
+         }
+
+         if (code == 0) {
+            style.foreground = -1;
+            style.background = -1;
+            style.attributes = 0;
+         } else if ((code >= 1 && code <= 9) || code == 21) {
+            style.attributes |= 1u << code;
+         } else if (code == 22) {
+            style.attributes &= ~((1u << 1) | (1u << 2));
+         } else if ((code >= 30 && code <= 37) || (code >= 90 && code <= 97)) {
+            style.foreground = code;
+         } else if (code == 39) {
+            style.foreground = -1;
+         } else if ((code >= 40 && code <= 47)
+           || (code >= 100 && code <= 107)) {
+            style.background = code;
+         } else if (code == 49) {
+            style.background = -1;
+         }
+
+         start = end + 1;
+      }
+   }
+
+   // Append a number in decimal, without allocating
+   void appendNumber(size_t value, std::string& output) {
+      char buffer[24];
+      std::to_chars_result const result { std::to_chars(
+        buffer, buffer + sizeof(buffer), value) };
+      output.append(buffer, result.ptr);
+   }
+}
+
+// Check if two cells look the same
+bool ScreenCell::operator==(ScreenCell const& rhs) const {
+   return glyph_size == rhs.glyph_size
+     && std::memcmp(glyph, rhs.glyph, glyph_size) == 0 && hasStyleOf(rhs);
+}
+
+// Check if two cells have the same style
+bool ScreenCell::hasStyleOf(ScreenCell const& rhs) const {
+   return foreground == rhs.foreground && background == rhs.background
+     && attributes == rhs.attributes;
+}
+
+// Get the colors the cell is shown with
+void ScreenCell::getPaletteColors(short& ink, short& paper) const {
+   // Normal colors are 30 to 37 (40 to 47) and bright ones 90 to 97 (100 to
+   // 107)
+   auto const index { [](short code) -> short {
+      return static_cast<short>(code % 10 + (code >= 90 ? 8 : 0));
+   } };
+
+   ink = foreground == -1 ? DEFAULT_INK : index(foreground);
+   paper = background == -1 ? DEFAULT_PAPER : index(background);
+
+   if ((attributes & (1u << 1)) && ink < 8) {
+      // Bold characters are shown in the bright colors
+      ink += 8;
+   }
+
+   if (attributes & (1u << 7)) {
+      // Reverse video
+      std::swap(ink, paper);
+   }
+
+   if (attributes & (1u << 8)) {
+      // Concealed
+      ink = paper;
+   }
+}
+
+// Check if a file descriptor is a terminal
+bool TerminalScreen::isTerminal(int descriptor) {
+#ifdef TERMINAL_SCREEN_IOCTL_SUPPORTED
+   return isatty(descriptor) == 1;
+#else
+   (void)descriptor;
+   return false;
+#endif
+}
+
+// Get the number of rows of a terminal
+unsigned short TerminalScreen::getRows(int descriptor) {
+   unsigned short rows_;
+   unsigned short columns_;
+   getSize(descriptor, rows_, columns_);
+   return rows_;
+}
+
+// Get the number of columns of a terminal
+unsigned short TerminalScreen::getColumns(int descriptor) {
+   unsigned short rows_;
+   unsigned short columns_;
+   getSize(descriptor, rows_, columns_);
+   return columns_;
+}
+
+// Get the size of a terminal with a single query
+void TerminalScreen::getSize(
+  int descriptor, unsigned short& rows_, unsigned short& columns_) {
+   rows_ = 0;
+   columns_ = 0;
+
+#ifdef TERMINAL_SCREEN_IOCTL_SUPPORTED
+   winsize size {};
+
+   if (ioctl(descriptor, TIOCGWINSZ, &size) == 0) {
+      rows_ = size.ws_row;
+      columns_ = size.ws_col;
+   }
+#else
+   (void)descriptor;
+#endif
+}
+
+// Turn a frame into the bytes that update the screen to it
+void TerminalScreen::update(std::string_view frame, std::string& output,
+  unsigned short _rows, unsigned short _columns) {
+   layout(frame);
+
+   size_t const new_rows { next_rows.size() - 1 };
+   bool fits { _rows == 0 || new_rows < _rows };
+
+   for (size_t row { 0 }; fits && _columns != 0 && row != new_rows; ++row) {
+      fits = next_rows[row + 1] - next_rows[row] <= _columns;
+   }
+
+   if (!fits) {
+      // The frame scrolls or wraps, so the cells cannot be addressed
+      output.append(frame);
+      reset();
+      return;
+   }
+
+   if (!drawn) {
+      output.append("\33[H\33[2J");
+      cells.clear();
+      rows.assign(1, 0);
+   }
+
+   size_t const old_rows { rows.size() - 1 };
+   ScreenCell current; ///< Style of the terminal, after a reset
+   size_t cursor_row { SIZE_MAX };
+   size_t cursor_column { SIZE_MAX };
+
+   for (size_t row { 0 }; row < std::max(old_rows, new_rows); ++row) {
+      ScreenCell const* old_row { row < old_rows ? &cells[rows[row]]
+                                                 : nullptr };
+      ScreenCell const* new_row { row < new_rows ? &next_cells[next_rows[row]]
+                                                 : nullptr };
+      size_t const old_size { row < old_rows ? rows[row + 1] - rows[row]
+                                             : 0 };
+      size_t const new_size { row < new_rows
+                                ? next_rows[row + 1] - next_rows[row]
+                                : 0 };
+
+      auto const unchanged { [&](size_t column) -> bool {
+         return column < old_size && old_row[column] == new_row[column];
+      } };
+
+      for (size_t column { 0 }; column < new_size;) {
+         if (unchanged(column)) {
+            ++column;
+            continue;
+         }
+
+         // Extend the span over short runs of unchanged cells
+         size_t end { column + 1 };
+         size_t gap { 0 };
+
+         for (; end < new_size && gap <= MAXIMUM_GAP; ++end) {
+            gap = unchanged(end) ? gap + 1 : 0;
+         }
+
+         end -= gap;
+
+         if (cursor_row != row || cursor_column != column) {
+            appendMove(row, column, output);
+         }
+
+         for (size_t index { column }; index < end; ++index) {
+            ScreenCell const& cell { new_row[index] };
+
+            if (!cell.hasStyleOf(current)) {
+               appendStyle(cell, output);
+               current = cell;
+            }
+
+            output.append(cell.glyph, cell.glyph_size);
+         }
+
+         cursor_row = row;
+         cursor_column = end;
+         column = end;
+      }
+
+      if (old_size > new_size) {
+         // Erase what is left of the old row
+         if (cursor_row != row || cursor_column != new_size) {
+            appendMove(row, new_size, output);
+         }
+
+         if (!current.hasStyleOf(ScreenCell())) {
+            output.append("\33[0m");
+            current = ScreenCell();
+         }
+
+         output.append("\33[K");
+         cursor_row = row;
+         cursor_column = new_size;
+      }
+   }
+
+   if (!current.hasStyleOf(ScreenCell())) {
+      output.append("\33[0m");
+   }
+
+   // Leave the cursor below the frame, where the next output goes
+   appendMove(new_rows, 0, output);
+
+   std::swap(cells, next_cells);
+   std::swap(rows, next_rows);
+   drawn = true;
+}
+
+// Get the size a frame takes on the screen
+void TerminalScreen::measure(
+  std::string_view frame, size_t& width, size_t& height) {
+   layout(frame);
+
+   width = 0;
+   height = next_rows.size() - 1;
+
+   for (size_t row { 0 }; row != height; ++row) {
+      width = std::max(width, next_rows[row + 1] - next_rows[row]);
+   }
+}
+
+// Lay a frame out into a grid of cells
+void TerminalScreen::layOut(std::string_view frame,
+  std::vector<ScreenCell>& cells_, std::vector<size_t>& rows_) {
+   layout(frame);
+
+   // The buffers of the caller are reused by the next layout
+   cells_.swap(next_cells);
+   rows_.swap(next_rows);
+}
+
+// Forget the screen
+void TerminalScreen::reset() {
+   cells.clear();
+   rows.assign(1, 0);
+   drawn = false;
+}
+
+// Lay a frame out into next_cells and next_rows
+void TerminalScreen::layout(std::string_view frame) {
+   next_cells.clear();
+   next_rows.assign(1, 0);
+
+   ScreenCell style;
+
+   for (size_t index { 0 }; index < frame.size(); ++index) {
+      unsigned char const character { static_cast<unsigned char>(
+        frame[index]) };
+
+      if (character == '\33' && index + 1 < frame.size()
+        && frame[index + 1] == '[') {
+         // Control sequence: parameters, then a final byte
+         size_t end { index + 2 };
+
+         while (end < frame.size()
+           && (frame[end] < 0x40 || frame[end] > 0x7E)) {
+            ++end;
+         }
+
+         if (end < frame.size() && frame[end] == 'm') {
+            applyStyle(frame.substr(index + 2, end - index - 2), style);
+         }
+
+         index = end;
+         continue;
+      }
+
+      if (character == '\n') {
+         next_rows.push_back(next_cells.size());
+         continue;
+      }
+
+      if (character == '\t') {
+         size_t const column { next_cells.size() - next_rows.back() };
+         ScreenCell blank { style };
+         next_cells.insert(
+           next_cells.end(), TAB_SIZE - column % TAB_SIZE, blank);
+         continue;
+      }
+
+      if (character < 0x20 || character == 0x7F) {
+         continue;
+      }
+
+      uint8_t size { 1 };
+
+      if (character >= 0xF0 && character <= 0xF7) {
+         size = 4;
+      } else if (character >= 0xE0) {
+         size = 3;
+      } else if (character >= 0xC0) {
+         size = 2;
+      }
+
+      size = static_cast<uint8_t>(
+        std::min<size_t>(size, frame.size() - index));
+
+      ScreenCell cell { style };
+      cell.glyph_size = size;
+
+      for (uint8_t byte { 0 }; byte != size; ++byte) {
+         cell.glyph[byte] = frame[index + byte];
+      }
+
+      next_cells.push_back(cell);
+      index += size - 1;
+   }
+
+   if (next_cells.size() > next_rows.back()) {
+      next_rows.push_back(next_cells.size());
+   }
+}
+
+// Append the sequence that switches to the style of a cell
+void TerminalScreen::appendStyle(ScreenCell const& cell, std::string& output) {
+   output.append("\33[0");
+
+   for (short code { 1 }; code <= 21; ++code) {
+      if (cell.attributes & (1u << code)) {
+         output.push_back(';');
+         appendNumber(code, output);
+      }
+   }
+
+   if (cell.foreground != -1) {
+      output.push_back(';');
+      appendNumber(cell.foreground, output);
+   }
+
+   if (cell.background != -1) {
+      output.push_back(';');
+      appendNumber(cell.background, output);
+   }
+
+   output.push_back('m');
+}
+
+// Append the sequence that moves the cursor
+void TerminalScreen::appendMove(size_t row, size_t column, std::string& output) {
+   output.append("\33[");
+   appendNumber(row + 1, output);
+   output.push_back(';');
+   appendNumber(column + 1, output);
+   output.push_back('H');
+}
@@ -0,0 +1,186 @@
+/**
+ * @file terminalscreen.hpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Contains a model of the terminal screen that turns a frame into the
+ * escape sequences that redraw only what changed since the last one.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#ifndef TERMINAL_SCREEN_HPP_
+#define TERMINAL_SCREEN_HPP_
+
+#include <cstdint> /// uint8_t, uint32_t
+
+#include <string> /// string
+
+#include <string_view> /// string_view
+
+#include <vector> /// vector
+
+///< Definition of system constants >//
+constexpr short DEFAULT_INK { 7 }; ///< Palette color of the characters
+constexpr short DEFAULT_PAPER { 0 }; ///< Palette color of the background
+
+/// The 16 ANSI colors, as shown by xterm
+inline constexpr uint8_t ANSI_PALETTE[16][3] {
+   { 0, 0, 0 }, // black
+   { 205, 0, 0 }, // red
+   { 0, 205, 0 }, // green
+   { 205, 205, 0 }, // yellow
+   { 0, 0, 238 }, // blue
+   { 205, 0, 205 }, // magenta
+   { 0, 205, 205 }, // cyan
+   { 229, 229, 229 }, // white
+   { 127, 127, 127 }, // bright black
+   { 255, 0, 0 }, // bright red
+   { 0, 255, 0 }, // bright green
+   { 255, 255, 0 }, // bright yellow
+   { 92, 92, 255 }, // bright blue
+   { 255, 0, 255 }, // bright magenta
+   { 0, 255, 255 }, // bright cyan
+   { 255, 255, 255 }, // bright white
+};
+
+/**
+ * @brief A position of the screen: a character and the style it is shown with
+ */
+struct ScreenCell {
+   char glyph[4] { ' ', 0, 0, 0 }; ///< UTF-8 bytes of the character
+   uint8_t glyph_size { 1 }; ///< Number of bytes of the character
+   short foreground { -1 }; ///< ANSI foreground color (-1: default)
+   short background { -1 }; ///< ANSI background color (-1: default)
+   uint32_t attributes { 0 }; ///< Bit n set when the ANSI style n is on
+
+   /**
+    * @brief Check if two cells look the same
+    * @param rhs The other cell
+    * @return true if both have the same character and style
+    */
+   bool operator==(ScreenCell const& rhs) const;
+
+   /**
+    * @brief Check if two cells have the same style
+    * @param rhs The other cell
+    * @return true if both have the same colors and attributes
+    */
+   bool hasStyleOf(ScreenCell const& rhs) const;
+
+   /**
+    * @brief Get the colors the cell is shown with, after the bold, reverse
+    * and concealed attributes
+    * @param ink Receives the ANSI_PALETTE index of the character
+    * @param paper Receives the ANSI_PALETTE index of the background
+    */
+   void getPaletteColors(short& ink, short& paper) const;
+};
+
+/**
+ * @brief Grid of the cells shown by the terminal, kept from one frame to the
+ * next
+ *
+ * A frame is the text that would be printed to redraw the whole screen, with
+ * the SGR escape sequences of fstring. It is laid out into a grid of cells and
+ * compared with the grid of the last frame, and only the spans that changed
+ * are written, after a cursor-addressing sequence. Every character is
+ * assumed to take one column.
+ */
+class TerminalScreen {
+   public:
+   /**
+    * @brief Check if a file descriptor is a terminal
+    * @param descriptor The descriptor
+    * @return true if it is a terminal
+    */
+   static bool isTerminal(int descriptor);
+
+   /**
+    * @brief Get the number of rows of a terminal
+    * @param descriptor The descriptor of the terminal
+    * @return Number of rows (0 if unknown)
+    */
+   static unsigned short getRows(int descriptor);
+
+   /**
+    * @brief Get the number of columns of a terminal
+    * @param descriptor The descriptor of the terminal
+    * @return Number of columns (0 if unknown)
+    */
+   static unsigned short getColumns(int descriptor);
+
+   /**
+    * @brief Get the size of a terminal with a single query
+    * @param descriptor The descriptor of the terminal
+    * @param rows_ Receives the number of rows (0 if unknown)
+    * @param columns_ Receives the number of columns (0 if unknown)
+    */
+   static void getSize(
+     int descriptor, unsigned short& rows_, unsigned short& columns_);
+
+   /**
+    * @brief Turn a frame into the bytes that update the screen to it
+    * @param frame The text of the whole frame
+    * @param output The string that receives the bytes to write
+    * @param _rows Rows of the terminal (0 if unknown). A frame taller than
+    * the terminal is written as it is and resets the screen model
+    * @param _columns Columns of the terminal (0 if unknown). A frame with a
+    * row wider than the terminal wraps, so it is written as it is as well
+    */
+   void update(std::string_view frame, std::string& output,
+     unsigned short _rows = 0, unsigned short _columns = 0);
+
+   /**
+    * @brief Get the size a frame takes on the screen, without drawing it
+    * @param frame The text of the frame
+    * @param width Receives the number of columns of its widest row
+    * @param height Receives its number of rows
+    */
+   void measure(std::string_view frame, size_t& width, size_t& height);
+
+   /**
+    * @brief Lay a frame out into a grid of cells, without drawing it
+    * @param frame The text of the frame
+    * @param cells_ Receives the cells, row after row
+    * @param rows_ Receives the start of each row in the cells, plus the end
+    */
+   void layOut(std::string_view frame, std::vector<ScreenCell>& cells_,
+     std::vector<size_t>& rows_);
+
+   /**
+    * @brief Forget the screen, so the next frame clears and redraws it
+    */
+   void reset();
+
+   private:
+   std::vector<ScreenCell> cells; ///< Cells of the last frame, row after row
+   std::vector<size_t> rows; ///< Start of each row of the last frame, plus end
+   std::vector<ScreenCell> next_cells; ///< Cells of the frame being laid out
+   std::vector<size_t> next_rows; ///< Start of each row being laid out
+   bool drawn { false }; ///< The screen shows the last frame
+
+   /**
+    * @brief Lay a frame out into next_cells and next_rows
+    * @param frame The text of the frame
+    */
+   void layout(std::string_view frame);
+
+   /**
+    * @brief Append the sequence that switches to the style of a cell
+    * @param cell The cell
+    * @param output The string that receives the sequence
+    */
+   static void appendStyle(ScreenCell const& cell, std::string& output);
+
+   /**
+    * @brief Append the sequence that moves the cursor
+    * @param row Row, from 0
+    * @param column Column, from 0
+    * @param output The string that receives the sequence
+    */
+   static void appendMove(size_t row, size_t column, std::string& output);
+};
+
+#endif /// TERMINAL_SCREEN_HPP_
@@ -0,0 +1,184 @@
+/**
+ * @file BarChartTest.cpp
+ * @author Pedro Lucas (pedrolucas.jsrn@gmail.com)
+ * @brief Tests of the order of the bars of a BarChart.
+ * @version 1.0
+ * @date 2026-10-16
+ *
+ * @copyright Copyright (c) 2023
+ *
+ */
+
+#include "BarChart.hpp"
+#include "FrameRanker.hpp"
+#include "FrameTweener.hpp"
+#include "framebuffer.hpp" /// FrameBuffer
+#include "stringpool.hpp" /// StringPool
+
+#include <cmath> /// isnan, nan
+
+#include <iostream> /// cerr
+
+#include <memory> /// make_shared
+
+#include <string> /// string, to_string
+
+#include <vector> /// vector
+
+namespace {
+   int failures { 0 }; ///< Number of checks that failed
+
+   // Report a check that failed
+   void check(bool condition, std::string const& message) {
+      if (!condition) {
+         std::cerr << "FAILED: " << message << "\n";
+         ++failures;
+      }
+   }
+
+   // Build a bar chart with a bar of each value, labeled by its position
+   BarChart makeBarChart(std::vector<long double> const& values) {
+      StringPool& pool { StringPool::getInstance() };
+      uint32_t const category { pool.intern("category") };
+      BarChart bar_chart { "0" };
+
+      for (size_t index { 0 }; index != values.size(); ++index) {
+         Bar bar { pool.intern("bar " + std::to_string(index)),
+            0,
+            category,
+            values[index] };
+         bar_chart.addBar(&bar);
+      }
+
+      return bar_chart;
+   }
+
+   // Check that the first bars are the largest ones, in order, with the
+   // values that are not numbers last
+   void checkOrdered(
+     BarChart const& bar_chart, size_t count, std::string const& name) {
+      long double const* values { bar_chart.getValues() };
+
+      for (size_t index { 1 }; index < count; ++index) {
+         bool const previous_number { !std::isnan(values[index - 1]) };
+         bool const number { !std::isnan(values[index]) };
+
+         check(previous_number || !number,
+           name + ": a number after a value that is not a number");
+         check(!previous_number || !number
+             || values[index - 1] >= values[index],
+           name + ": bars out of order at " + std::to_string(index));
+      }
+   }
+
+   // Rank values that are not numbers with the FrameRanker
+   void testRankNotANumber() {
+      long double const nan { std::nanl("") };
+      BarChart bar_chart { makeBarChart({ 5, nan, 9 }) };
+      FrameRanker ranker { 3, 0 };
+      ranker.rank(bar_chart);
+
+      long double const* values { bar_chart.getValues() };
+      check(values[0] == 9 && values[1] == 5 && std::isnan(values[2]),
+        "rank: 5, nan, 9 is not ranked as 9, 5, nan");
+
+      // A reversed order with values that are not numbers moves too many
+      // bars, so the ranker sorts from scratch
+      std::vector<long double> ascending;
+      std::vector<long double> descending;
+
+      for (size_t index { 0 }; index != 200; ++index) {
+         ascending.push_back(index % 7 == 0 ? nan : index);
+         descending.push_back(index % 7 == 0 ? nan : 200 - index);
+      }
+
+      FrameRanker sequence { 10, 5 };
+      BarChart first { makeBarChart(ascending) };
+      sequence.rank(first);
+      checkOrdered(first, 10, "rank first");
+
+      BarChart second { makeBarChart(descending) };
+      sequence.rank(second);
+      checkOrdered(second, 10, "rank second");
+   }
+
+   // Order values that are not numbers with BarChart::order
+   void testOrderNotANumber() {
+      long double const nan { std::nanl("") };
+      BarChart bar_chart { makeBarChart({ nan, 5, nan, 9, 5 }) };
+      bar_chart.order(bar_chart.getNumberOfBars());
+
+      long double const* values { bar_chart.getValues() };
+      check(values[0] == 9 && values[1] == 5 && values[2] == 5
+          && std::isnan(values[3]) && std::isnan(values[4]),
+        "order: nan, 5, nan, 9, 5 is not ordered as 9, 5, 5, nan, nan");
+
+      StringPool const& pool { StringPool::getInstance() };
+      check(pool.resolve(bar_chart.getLabels()[1]) == "bar 1"
+          && pool.resolve(bar_chart.getLabels()[3]) == "bar 0",
+        "order: equal values do not keep the order they were added in");
+
+      std::vector<long double> mixed;
+
+      for (size_t index { 0 }; index != 100; ++index) {
+         mixed.push_back(index % 3 == 0 ? nan : (index * 37) % 101);
+      }
+
+      BarChart partial { makeBarChart(mixed) };
+      partial.order(10);
+      checkOrdered(partial, 10, "order partial");
+   }
+
+   // Draw bars that claim to be in order but are not
+   void testDrawOutOfOrder() {
+      long double const nan { std::nanl("") };
+      BarChart source { makeBarChart({ 1, 500, -300, nan, 9000 }) };
+      auto columns { std::make_shared<BarColumns>() };
+      columns->append(*source.getColumns(), source.getFirst(), 5);
+
+      BarChart bar_chart { "0", columns, 0, 5, 5 };
+      FrameBuffer frame;
+
+      try {
+         bar_chart.drawBars(frame, 40, 5, 5, 80);
+      } catch (...) {
+         check(false, "draw: bars out of order abort the drawing");
+      }
+   }
+
+   // Tween between bar charts with values that are not numbers
+   void testTweenNotANumber() {
+      long double const nan { std::nanl("") };
+      std::vector<long double> from_values;
+      std::vector<long double> to_values;
+
+      for (size_t index { 0 }; index != 200; ++index) {
+         from_values.push_back(index % 4 == 0 ? nan : index);
+         to_values.push_back(index % 5 == 0 ? nan : 200 - index);
+      }
+
+      BarChart from { makeBarChart(from_values) };
+      BarChart to { makeBarChart(to_values) };
+      from.order(from.getNumberOfBars());
+      to.order(to.getNumberOfBars());
+
+      FrameTweener tweener;
+      tweener.setKeyframes(from, to);
+
+      for (double progress : { 0.25, 0.5, 1.0 }) {
+         BarChart const& frame { tweener.at(progress) };
+         checkOrdered(frame,
+           frame.getNumberOfBars(),
+           "tween at " + std::to_string(progress));
+      }
+   }
+}
+
+int main() {
+   testRankNotANumber();
+   testOrderNotANumber();
+   testDrawOutOfOrder();
+   testTweenNotANumber();
+
+   return failures == 0 ? 0 : 1;
+}